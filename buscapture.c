@@ -0,0 +1,82 @@
+#include "mode7_demo.h"
+#include "hardware/dma.h"
+#include <string.h>
+
+// Our video output programs for the PIO
+#include "mode7.pio.h"
+
+// Capture of the Electron's writes to the Mode 7 screen at &7C00-&7FFF,
+// by the bus_capture PIO program (see mode7.pio), into a copy of the
+// screen that mode7_display_field() can show.
+//
+// The PIO pushes two words for each access to the screen: the address in
+// bus_page[] that it's for, then the data.  A pair of DMA channels takes
+// them from there, with no CPU involvement at all, so nothing the cores
+// are doing (eg. rendering) can make it miss any.  The address channel
+// copies the address into the data channel's write address trigger
+// register, which starts it; the data channel copies the byte and then
+// chains back to the address channel, ready for the next.  Each write
+// takes the DMA a few cycles, where the bus can't do one more than every
+// 500ns, and the joined FIFO holds four more while it's busy elsewhere.
+
+// The screen is 1000 bytes from &7C00; the last 24 bytes of the 1K take
+// any writes to &7FE8-&7FFF.  Aligned so that the PIO can make the
+// address of each byte by just appending the bottom 10 bits.
+static uint8_t bus_page[1024] __attribute__((aligned(1024)));
+
+static unsigned bus_addr_dma, bus_data_dma;
+
+#define	RXSTALL_BIT		(1u << (PIO_FDEBUG_RXSTALL_LSB + BUS_CAPTURE_SM))
+
+// Start capturing the screen writes.  Returns the copy of the screen,
+// which is blank until the Electron writes to it.
+const uint8_t *buscapture_start(void)
+{
+	unsigned offset;
+	dma_channel_config cfg;
+
+	memset(bus_page, ' ', sizeof(bus_page));
+
+	bus_addr_dma = dma_claim_unused_channel(true);
+	bus_data_dma = dma_claim_unused_channel(true);
+
+	cfg = dma_channel_get_default_config(bus_addr_dma);
+	channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+	channel_config_set_read_increment(&cfg, false);
+	channel_config_set_write_increment(&cfg, false);
+	channel_config_set_dreq(&cfg,
+		pio_get_dreq(SYNC_PIO, BUS_CAPTURE_SM, false));
+	dma_channel_configure(bus_addr_dma, &cfg,
+		&dma_hw->ch[bus_data_dma].al2_write_addr_trig,
+		&SYNC_PIO->rxf[BUS_CAPTURE_SM], 1, false);
+
+	// The byte is in bits 0-7 of the FIFO word, so a byte read gets it
+	cfg = dma_channel_get_default_config(bus_data_dma);
+	channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+	channel_config_set_read_increment(&cfg, false);
+	channel_config_set_write_increment(&cfg, false);
+	channel_config_set_dreq(&cfg,
+		pio_get_dreq(SYNC_PIO, BUS_CAPTURE_SM, false));
+	channel_config_set_chain_to(&cfg, bus_addr_dma);
+	dma_channel_configure(bus_data_dma, &cfg, bus_page,
+		&SYNC_PIO->rxf[BUS_CAPTURE_SM], 1, false);
+
+	dma_channel_start(bus_addr_dma);
+
+	// Load the PIO program and start the state machine
+	offset = pio_add_program(SYNC_PIO, &bus_capture_program);
+	bus_capture_init(SYNC_PIO, BUS_CAPTURE_SM, offset, (uintptr_t)bus_page);
+	SYNC_PIO->fdebug = RXSTALL_BIT;
+
+	return bus_page;
+}
+
+// Whether the capture has missed any bus cycles since the last call,
+// because the DMA didn't keep up and the PIO stalled on a full FIFO.
+bool buscapture_overrun(void)
+{
+	bool overrun = (SYNC_PIO->fdebug & RXSTALL_BIT) != 0;
+
+	if (overrun) SYNC_PIO->fdebug = RXSTALL_BIT;
+	return overrun;
+}
@@ -1,4 +1,4 @@
-#include "mode7_demo.h"
+#include "mode7_render.h"
 
 /*
   This font data was extracted from the fonts supplied with Xbeeb V0.36
@@ -2055,16155 +2055,3 @@ const uint16_t font_std[96 * 20] = {
 	0b000000000000,
 };
 
-const uint16_t font_std_dh_upper[96 * 20] = {
-// Character 0x20, ' ':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x21, '!':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x22, '"':
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x23, '#':
-	0b000110000000,
-	0b001111000000,
-	0b011111100000,
-	0b011111100000,
-	0b111001110000,
-	0b111001110000,
-	0b110000110000,
-	0b110000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000011111100,
-	0b000011111100,
-	0b000011111100,
-	0b000011111100,
-// Character 0x24, '$':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111011011100,
-	0b111011011100,
-	0b110011001100,
-	0b110011001100,
-	0b000011001100,
-	0b000011001100,
-	0b000011011100,
-	0b000011011100,
-	0b000111111000,
-	0b001111111000,
-	0b011111110000,
-	0b011111100000,
-	0b111011000000,
-	0b111011000000,
-	0b110011000000,
-	0b110011000000,
-// Character 0x25, '%':
-	0b000000011000,
-	0b000000011000,
-	0b100000111100,
-	0b100000111100,
-	0b110000011000,
-	0b110000011000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-// Character 0x26, '&':
-	0b000000110000,
-	0b000000110000,
-	0b000001111000,
-	0b000001111000,
-	0b000011111100,
-	0b000011111100,
-	0b000011001100,
-	0b000011001100,
-	0b000011001100,
-	0b000011001100,
-	0b000011111100,
-	0b000011111100,
-	0b000001111000,
-	0b000001111000,
-	0b000001111000,
-	0b000001111000,
-	0b110011111100,
-	0b110011111100,
-	0b110111001100,
-	0b110111001100,
-// Character 0x27, ''':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x28, '(':
-	0b001100000000,
-	0b001100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000001110000,
-	0b000001110000,
-// Character 0x29, ')':
-	0b000000110000,
-	0b000000110000,
-	0b000001110000,
-	0b000001110000,
-	0b000011100000,
-	0b000011100000,
-	0b000111000000,
-	0b000111000000,
-	0b001110000000,
-	0b001110000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001110000000,
-	0b001110000000,
-// Character 0x2a, '*':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b110011001100,
-	0b110011001100,
-	0b111011011100,
-	0b111011011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-// Character 0x2b, '+':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x2c, ',':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x2d, '-':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2e, '.':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2f, '/':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b100000000000,
-	0b110000000000,
-	0b110000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-// Character 0x30, '0':
-	0b000000000000,
-	0b000011000000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011100111000,
-	0b011100111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-// Character 0x31, '1':
-	0b000011000000,
-	0b000011000000,
-	0b000011100000,
-	0b000011100000,
-	0b000011110000,
-	0b000011110000,
-	0b000011110000,
-	0b000011110000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x32, '2':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011100111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000000000,
-	0b110000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011110000000,
-	0b001111000000,
-	0b000111100000,
-	0b000011110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-// Character 0x33, '3':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b110000000000,
-	0b110000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b001111000000,
-	0b001111000000,
-	0b011111000000,
-	0b011111000000,
-	0b111000000000,
-	0b111000000000,
-	0b110000000000,
-	0b110000000000,
-// Character 0x34, '4':
-	0b001100000000,
-	0b001100000000,
-	0b001110000000,
-	0b001110000000,
-	0b001111000000,
-	0b001111000000,
-	0b001111100000,
-	0b001111100000,
-	0b001101110000,
-	0b001101110000,
-	0b001100111000,
-	0b001100111000,
-	0b001100011100,
-	0b001100011100,
-	0b001100001100,
-	0b001100001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-// Character 0x35, '5':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000011111100,
-	0b001111111100,
-	0b011111111100,
-	0b111111111100,
-	0b111100000000,
-	0b111000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-// Character 0x36, '6':
-	0b001110000000,
-	0b001111000000,
-	0b000111100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-	0b000000011100,
-	0b000000011100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x37, '7':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b110000000000,
-	0b110000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000110000,
-	0b000000110000,
-// Character 0x38, '8':
-	0b001111110000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x39, '9':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111100000,
-	0b110000000000,
-	0b110000000000,
-	0b111000000000,
-	0b111000000000,
-// Character 0x3a, ':':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3b, ';':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3c, '<':
-	0b001100000000,
-	0b001100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-	0b000000011100,
-	0b000000011100,
-	0b000000011100,
-	0b000000011100,
-	0b000000111000,
-	0b000000111000,
-	0b000001110000,
-	0b000001110000,
-// Character 0x3d, '=':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3e, '>':
-	0b000000110000,
-	0b000000110000,
-	0b000001110000,
-	0b000001110000,
-	0b000011100000,
-	0b000011100000,
-	0b000111000000,
-	0b000111000000,
-	0b001110000000,
-	0b001110000000,
-	0b011100000000,
-	0b011100000000,
-	0b111000000000,
-	0b111000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-// Character 0x3f, '?':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b111000001100,
-	0b111000001100,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x40, '@':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b111110001100,
-	0b111110001100,
-	0b111111001100,
-	0b111111001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111001100,
-	0b111111001100,
-	0b011110001100,
-	0b011110001100,
-// Character 0x41, 'A':
-	0b000011000000,
-	0b000011000000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011100111000,
-	0b011100111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-// Character 0x42, 'B':
-	0b001111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x43, 'C':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x44, 'D':
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x45, 'E':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x46, 'F':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x47, 'G':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111100001100,
-	0b111100001100,
-	0b111100001100,
-	0b111100001100,
-// Character 0x48, 'H':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x49, 'I':
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x4a, 'J':
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-// Character 0x4b, 'K':
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011100001100,
-	0b011100001100,
-	0b001110001100,
-	0b001110001100,
-	0b000111001100,
-	0b000111001100,
-	0b000011101100,
-	0b000011101100,
-	0b000001111100,
-	0b000001111100,
-	0b000001111100,
-	0b000001111100,
-	0b000011101100,
-	0b000011101100,
-	0b000111001100,
-	0b000111001100,
-// Character 0x4c, 'L':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x4d, 'M':
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b111100111100,
-	0b111100111100,
-	0b111111111100,
-	0b111111111100,
-	0b110111101100,
-	0b110111101100,
-	0b110011001100,
-	0b110011001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x4e, 'N':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b110000111100,
-	0b110000111100,
-	0b110001111100,
-	0b110001111100,
-	0b110011101100,
-	0b110011101100,
-	0b110111001100,
-	0b110111001100,
-	0b111110001100,
-	0b111110001100,
-	0b111100001100,
-	0b111100001100,
-// Character 0x4f, 'O':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x50, 'P':
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x51, 'Q':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110011001100,
-	0b110111001100,
-	0b110111001100,
-// Character 0x52, 'R':
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b001111111100,
-	0b000011101100,
-	0b000011101100,
-	0b000111001100,
-	0b000111001100,
-// Character 0x53, 'S':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000011100,
-	0b000000111100,
-	0b000011111000,
-	0b001111111000,
-	0b011111110000,
-	0b011111000000,
-	0b111100000000,
-	0b111000000000,
-	0b110000000000,
-	0b110000000000,
-// Character 0x54, 'T':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x55, 'U':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x56, 'V':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001111110000,
-	0b001111110000,
-// Character 0x57, 'W':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-// Character 0x58, 'X':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001111110000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011100111000,
-	0b011100111000,
-// Character 0x59, 'Y':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001111110000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x5a, 'Z':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b110000000000,
-	0b110000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-// Character 0x5b, '[':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000111000,
-	0b000000111000,
-	0b000001110000,
-	0b000001110000,
-// Character 0x5c, '\':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111001100,
-	0b001111001100,
-	0b011111001100,
-	0b011111001100,
-// Character 0x5d, ']':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000111000000,
-	0b000111000000,
-	0b001110000000,
-	0b001110000000,
-	0b011100000000,
-	0b011100000000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-// Character 0x5e, '^':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111011011100,
-	0b111011011100,
-	0b110011001100,
-	0b110011001100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x5f, '_':
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-// Character 0x60, '`':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x61, 'a':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b001111110000,
-	0b001111110000,
-	0b011111110000,
-	0b011111110000,
-	0b111000000000,
-	0b111000000000,
-	0b110000000000,
-	0b110000000000,
-	0b111111110000,
-	0b111111110000,
-	0b111111111000,
-	0b111111111000,
-// Character 0x62, 'b':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x63, 'c':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111110000,
-	0b111111110000,
-	0b111111111000,
-	0b111111111000,
-	0b000000011100,
-	0b000000011100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x64, 'd':
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b111111110000,
-	0b111111110000,
-	0b111111111000,
-	0b111111111000,
-	0b110000011100,
-	0b110000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x65, 'e':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-// Character 0x66, 'f':
-	0b001000000000,
-	0b001100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x67, 'g':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111110000,
-	0b111111110000,
-	0b111111111000,
-	0b111111111000,
-	0b110000011100,
-	0b110000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x68, 'h':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x69, 'i':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011110000,
-	0b000011110000,
-	0b000011110000,
-	0b000011110000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x6a, 'j':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x6b, 'k':
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b110000110000,
-	0b110000110000,
-	0b111000110000,
-	0b111000110000,
-	0b011100110000,
-	0b011100110000,
-	0b001110110000,
-	0b001110110000,
-	0b000111110000,
-	0b000111110000,
-	0b000111110000,
-	0b000111110000,
-// Character 0x6c, 'l':
-	0b000011110000,
-	0b000011110000,
-	0b000011110000,
-	0b000011110000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x6d, 'm':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b001100111100,
-	0b011111111100,
-	0b011111111100,
-	0b111111101100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-// Character 0x6e, 'n':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x6f, 'o':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x70, 'p':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x71, 'q':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111100000,
-	0b111111110000,
-	0b111111111000,
-	0b111111111000,
-	0b110000011100,
-	0b110000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x72, 'r':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111000110000,
-	0b111100110000,
-	0b111110110000,
-	0b001110110000,
-	0b000111110000,
-	0b000111110000,
-	0b000011110000,
-	0b000011110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-// Character 0x73, 's':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111100000,
-	0b111111110000,
-	0b111111111000,
-	0b111111111000,
-	0b000000011100,
-	0b000000011100,
-	0b000000011100,
-	0b000000011100,
-	0b001111111000,
-	0b001111111000,
-	0b011111110000,
-	0b011111110000,
-// Character 0x74, 't':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x75, 'u':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x76, 'v':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001100110000,
-	0b001100110000,
-// Character 0x77, 'w':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-// Character 0x78, 'x':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001111110000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000111100000,
-	0b000111100000,
-// Character 0x79, 'y':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x7a, 'z':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-// Character 0x7b, '{':
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b110000110000,
-	0b110000110000,
-	0b111000110000,
-	0b111000110000,
-// Character 0x7c, '|':
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-// Character 0x7d, '}':
-	0b000000011100,
-	0b000000111100,
-	0b000001111100,
-	0b000001111100,
-	0b000011100000,
-	0b000011100000,
-	0b000011100000,
-	0b000011100000,
-	0b000001111100,
-	0b000001111100,
-	0b000001111100,
-	0b000001111100,
-	0b000011100000,
-	0b000011100000,
-	0b000011100000,
-	0b000011100000,
-	0b110001111100,
-	0b110001111100,
-	0b111000111100,
-	0b111000111100,
-// Character 0x7e, '~':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7f, '':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-};
-
-const uint16_t font_std_dh_lower[96 * 20] = {
-// Character 0x20, ' ':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x21, '!':
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x22, '"':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x23, '#':
-	0b000011111100,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x24, '$':
-	0b110011000000,
-	0b110011001100,
-	0b110011001100,
-	0b111011011100,
-	0b111011011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x25, '%':
-	0b000000111000,
-	0b011000011100,
-	0b011000011100,
-	0b111100001100,
-	0b111100001100,
-	0b111100000000,
-	0b111100000000,
-	0b011000000000,
-	0b011000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x26, '&':
-	0b110111001100,
-	0b101110001100,
-	0b101110001100,
-	0b011100011100,
-	0b011100011100,
-	0b111011111000,
-	0b111011111000,
-	0b110111110000,
-	0b110011100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x27, ''':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x28, '(':
-	0b000001110000,
-	0b000011100000,
-	0b000011100000,
-	0b000111000000,
-	0b000111000000,
-	0b001110000000,
-	0b001110000000,
-	0b001100000000,
-	0b001100000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x29, ')':
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2a, '*':
-	0b011111111000,
-	0b111011011100,
-	0b111011011100,
-	0b110011001100,
-	0b110011001100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2b, '+':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2c, ',':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2d, '-':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2e, '.':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2f, '/':
-	0b000000111000,
-	0b000000011100,
-	0b000000011100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x30, '0':
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001111110000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x31, '1':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x32, '2':
-	0b000000111000,
-	0b000000011100,
-	0b000000011100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x33, '3':
-	0b110000000000,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x34, '4':
-	0b111111111100,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b001100000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x35, '5':
-	0b110000000000,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x36, '6':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x37, '7':
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x38, '8':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x39, '9':
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111110000,
-	0b000011110000,
-	0b000001110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3a, ':':
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3b, ';':
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3c, '<':
-	0b000001110000,
-	0b000011100000,
-	0b000011100000,
-	0b000111000000,
-	0b000111000000,
-	0b001110000000,
-	0b001110000000,
-	0b001100000000,
-	0b001100000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3d, '=':
-	0b000000000000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3e, '>':
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3f, '?':
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x40, '@':
-	0b011110001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000011100,
-	0b000000011100,
-	0b001111111000,
-	0b001111111000,
-	0b001111110000,
-	0b001111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x41, 'A':
-	0b111111111100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x42, 'B':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x43, 'C':
-	0b000000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x44, 'D':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x45, 'E':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x46, 'F':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x47, 'G':
-	0b111100001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x48, 'H':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x49, 'I':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4a, 'J':
-	0b110000000000,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4b, 'K':
-	0b000111001100,
-	0b001110001100,
-	0b001110001100,
-	0b011100001100,
-	0b011100001100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4c, 'L':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4d, 'M':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4e, 'N':
-	0b111100001100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4f, 'O':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x50, 'P':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x51, 'Q':
-	0b110111001100,
-	0b001110001100,
-	0b001110001100,
-	0b011100011100,
-	0b011100011100,
-	0b111011111000,
-	0b111011111000,
-	0b110111110000,
-	0b110011110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x52, 'R':
-	0b000111001100,
-	0b001110001100,
-	0b001110001100,
-	0b011100001100,
-	0b011100001100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x53, 'S':
-	0b110000000000,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x54, 'T':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x55, 'U':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x56, 'V':
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x57, 'W':
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111111100,
-	0b111111111100,
-	0b011111111000,
-	0b011111111000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x58, 'X':
-	0b011100111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x59, 'Y':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5a, 'Z':
-	0b000000111000,
-	0b000000011100,
-	0b000000011100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5b, '[':
-	0b000001110000,
-	0b000011100000,
-	0b000011100000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5c, '\':
-	0b011111001100,
-	0b111000000000,
-	0b111000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011000000,
-	0b000011000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5d, ']':
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5e, '^':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5f, '_':
-	0b111111111100,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x60, '`':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x61, 'a':
-	0b111111111000,
-	0b110000011100,
-	0b110000011100,
-	0b110000011100,
-	0b110000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x62, 'b':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x63, 'c':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000011100,
-	0b000000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x64, 'd':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x65, 'e':
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000011100,
-	0b000000011100,
-	0b001111111000,
-	0b001111111000,
-	0b001111110000,
-	0b001111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x66, 'f':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x67, 'g':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111110000,
-	0b110000000000,
-	0b110000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011111110000,
-	0b011111110000,
-	0b001111110000,
-	0b000111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x68, 'h':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x69, 'i':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6a, 'j':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6b, 'k':
-	0b000111110000,
-	0b001110110000,
-	0b001110110000,
-	0b011100110000,
-	0b011100110000,
-	0b111000110000,
-	0b111000110000,
-	0b110000110000,
-	0b110000110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6c, 'l':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6d, 'm':
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6e, 'n':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6f, 'o':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x70, 'p':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x71, 'q':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111100000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x72, 'r':
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x73, 's':
-	0b011111110000,
-	0b111000000000,
-	0b111000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x74, 't':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000111000000,
-	0b000111000000,
-	0b001110000000,
-	0b001110000000,
-	0b001100000000,
-	0b001100000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x75, 'u':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x76, 'v':
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001111110000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x77, 'w':
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111111100,
-	0b111111111100,
-	0b011111111000,
-	0b011111111000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x78, 'x':
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011100111000,
-	0b011100111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x79, 'y':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111100000,
-	0b110000000000,
-	0b110000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011111110000,
-	0b011111110000,
-	0b001111110000,
-	0b000111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7a, 'z':
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7b, '{':
-	0b111000110000,
-	0b111100000000,
-	0b111100000000,
-	0b111110000000,
-	0b111110000000,
-	0b110111000000,
-	0b110111000000,
-	0b110011000000,
-	0b110011000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7c, '|':
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7d, '}':
-	0b111000111100,
-	0b111100000000,
-	0b111100000000,
-	0b111110000000,
-	0b111110000000,
-	0b110111000000,
-	0b110111000000,
-	0b110011000000,
-	0b110011000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7e, '~':
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7f, '':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-};
-
-const uint16_t font_graphic[96 * 20] = {
-// Character 0x20, ' ':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x21, '!':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x22, '"':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x23, '#':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x24, '$':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x25, '%':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x26, '&':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x27, ''':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x28, '(':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x29, ')':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2a, '*':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2b, '+':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2c, ',':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2d, '-':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2e, '.':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2f, '/':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x30, '0':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x31, '1':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x32, '2':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x33, '3':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x34, '4':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x35, '5':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x36, '6':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x37, '7':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x38, '8':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x39, '9':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3a, ':':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3b, ';':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3c, '<':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3d, '=':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3e, '>':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3f, '?':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x40, '@':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b111110001100,
-	0b111111001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111001100,
-	0b011110001100,
-	0b000000001100,
-	0b000000011100,
-	0b001111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x41, 'A':
-	0b000011000000,
-	0b000111100000,
-	0b001111110000,
-	0b011100111000,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x42, 'B':
-	0b001111111100,
-	0b011111111100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b011111111100,
-	0b001111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x43, 'C':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x44, 'D':
-	0b001111111100,
-	0b011111111100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b011111111100,
-	0b001111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x45, 'E':
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x46, 'F':
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x47, 'G':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111100001100,
-	0b111100001100,
-	0b110000001100,
-	0b110000011100,
-	0b111111111000,
-	0b111111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x48, 'H':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x49, 'I':
-	0b001111110000,
-	0b001111110000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b001111110000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4a, 'J':
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000001100,
-	0b111000011100,
-	0b011111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4b, 'K':
-	0b110000001100,
-	0b111000001100,
-	0b011100001100,
-	0b001110001100,
-	0b000111001100,
-	0b000011101100,
-	0b000001111100,
-	0b000001111100,
-	0b000011101100,
-	0b000111001100,
-	0b001110001100,
-	0b011100001100,
-	0b111000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4c, 'L':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4d, 'M':
-	0b110000001100,
-	0b111000011100,
-	0b111100111100,
-	0b111111111100,
-	0b110111101100,
-	0b110011001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4e, 'N':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000111100,
-	0b110001111100,
-	0b110011101100,
-	0b110111001100,
-	0b111110001100,
-	0b111100001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4f, 'O':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x50, 'P':
-	0b001111111100,
-	0b011111111100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b011111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x51, 'Q':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110111001100,
-	0b001110001100,
-	0b011100011100,
-	0b111011111000,
-	0b110011110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x52, 'R':
-	0b001111111100,
-	0b011111111100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b011111111100,
-	0b001111111100,
-	0b000011101100,
-	0b000111001100,
-	0b001110001100,
-	0b011100001100,
-	0b111000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x53, 'S':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b000000001100,
-	0b000000011100,
-	0b001111111000,
-	0b011111110000,
-	0b111000000000,
-	0b110000000000,
-	0b110000001100,
-	0b111000011100,
-	0b011111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x54, 'T':
-	0b111111111100,
-	0b111111111100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x55, 'U':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x56, 'V':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011100111000,
-	0b001100110000,
-	0b001100110000,
-	0b001111110000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x57, 'W':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111111100,
-	0b011111111000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x58, 'X':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011100111000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b011100111000,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x59, 'Y':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011100111000,
-	0b001111110000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5a, 'Z':
-	0b111111111100,
-	0b111111111100,
-	0b110000000000,
-	0b111000000000,
-	0b011100000000,
-	0b001110000000,
-	0b000111000000,
-	0b000011100000,
-	0b000001110000,
-	0b000000111000,
-	0b000000011100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5b, '[':
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011100000,
-	0b000001110000,
-	0b000000111000,
-	0b111111111100,
-	0b111111111100,
-	0b000000111000,
-	0b000001110000,
-	0b000011100000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5c, '\':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111001100,
-	0b011111001100,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b001110000000,
-	0b000111000000,
-	0b000011000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5d, ']':
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000111000000,
-	0b001110000000,
-	0b011100000000,
-	0b111111111100,
-	0b111111111100,
-	0b011100000000,
-	0b001110000000,
-	0b000111000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5e, '^':
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b111011111100,
-	0b110011001100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5f, '_':
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b111111111100,
-	0b111111111100,
-	0b001100110000,
-	0b001100110000,
-	0b111111111100,
-	0b111111111100,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x60, '`':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x61, 'a':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x62, 'b':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x63, 'c':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x64, 'd':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x65, 'e':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x66, 'f':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x67, 'g':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x68, 'h':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x69, 'i':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6a, 'j':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6b, 'k':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6c, 'l':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6d, 'm':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6e, 'n':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6f, 'o':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x70, 'p':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x71, 'q':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x72, 'r':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x73, 's':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x74, 't':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x75, 'u':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x76, 'v':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x77, 'w':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x78, 'x':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x79, 'y':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7a, 'z':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7b, '{':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7c, '|':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7d, '}':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7e, '~':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7f, '':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-};
-
-const uint16_t font_graphic_dh_upper[96 * 20] = {
-// Character 0x20, ' ':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x21, '!':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x22, '"':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x23, '#':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x24, '$':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x25, '%':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x26, '&':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x27, ''':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x28, '(':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x29, ')':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x2a, '*':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x2b, '+':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x2c, ',':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x2d, '-':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x2e, '.':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x2f, '/':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x30, '0':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x31, '1':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x32, '2':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x33, '3':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x34, '4':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x35, '5':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x36, '6':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x37, '7':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x38, '8':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x39, '9':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x3a, ':':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x3b, ';':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x3c, '<':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x3d, '=':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x3e, '>':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x3f, '?':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x40, '@':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b111110001100,
-	0b111110001100,
-	0b111111001100,
-	0b111111001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111001100,
-	0b111111001100,
-	0b011110001100,
-	0b011110001100,
-// Character 0x41, 'A':
-	0b000011000000,
-	0b000011000000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011100111000,
-	0b011100111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-// Character 0x42, 'B':
-	0b001111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x43, 'C':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x44, 'D':
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x45, 'E':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x46, 'F':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x47, 'G':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111100001100,
-	0b111100001100,
-	0b111100001100,
-	0b111100001100,
-// Character 0x48, 'H':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x49, 'I':
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x4a, 'J':
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-// Character 0x4b, 'K':
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011100001100,
-	0b011100001100,
-	0b001110001100,
-	0b001110001100,
-	0b000111001100,
-	0b000111001100,
-	0b000011101100,
-	0b000011101100,
-	0b000001111100,
-	0b000001111100,
-	0b000001111100,
-	0b000001111100,
-	0b000011101100,
-	0b000011101100,
-	0b000111001100,
-	0b000111001100,
-// Character 0x4c, 'L':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x4d, 'M':
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b111100111100,
-	0b111100111100,
-	0b111111111100,
-	0b111111111100,
-	0b110111101100,
-	0b110111101100,
-	0b110011001100,
-	0b110011001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x4e, 'N':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b110000111100,
-	0b110000111100,
-	0b110001111100,
-	0b110001111100,
-	0b110011101100,
-	0b110011101100,
-	0b110111001100,
-	0b110111001100,
-	0b111110001100,
-	0b111110001100,
-	0b111100001100,
-	0b111100001100,
-// Character 0x4f, 'O':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x50, 'P':
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x51, 'Q':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110011001100,
-	0b110111001100,
-	0b110111001100,
-// Character 0x52, 'R':
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b001111111100,
-	0b000011101100,
-	0b000011101100,
-	0b000111001100,
-	0b000111001100,
-// Character 0x53, 'S':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000011100,
-	0b000000111100,
-	0b000011111000,
-	0b001111111000,
-	0b011111110000,
-	0b011111000000,
-	0b111100000000,
-	0b111000000000,
-	0b110000000000,
-	0b110000000000,
-// Character 0x54, 'T':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x55, 'U':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x56, 'V':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001111110000,
-	0b001111110000,
-// Character 0x57, 'W':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-// Character 0x58, 'X':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001111110000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011100111000,
-	0b011100111000,
-// Character 0x59, 'Y':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001111110000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x5a, 'Z':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b110000000000,
-	0b110000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-// Character 0x5b, '[':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000111000,
-	0b000000111000,
-	0b000001110000,
-	0b000001110000,
-// Character 0x5c, '\':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111001100,
-	0b001111001100,
-	0b011111001100,
-	0b011111001100,
-// Character 0x5d, ']':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000111000000,
-	0b000111000000,
-	0b001110000000,
-	0b001110000000,
-	0b011100000000,
-	0b011100000000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-// Character 0x5e, '^':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111011011100,
-	0b111011011100,
-	0b110011001100,
-	0b110011001100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x5f, '_':
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-// Character 0x60, '`':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x61, 'a':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x62, 'b':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x63, 'c':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x64, 'd':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x65, 'e':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x66, 'f':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x67, 'g':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x68, 'h':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x69, 'i':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6a, 'j':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6b, 'k':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6c, 'l':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x6d, 'm':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x6e, 'n':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x6f, 'o':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x70, 'p':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x71, 'q':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x72, 'r':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x73, 's':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x74, 't':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x75, 'u':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x76, 'v':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x77, 'w':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x78, 'x':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x79, 'y':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x7a, 'z':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x7b, '{':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x7c, '|':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7d, '}':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7e, '~':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7f, '':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-};
-
-const uint16_t font_graphic_dh_lower[96 * 20] = {
-// Character 0x20, ' ':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x21, '!':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x22, '"':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x23, '#':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x24, '$':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x25, '%':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x26, '&':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x27, ''':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x28, '(':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x29, ')':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2a, '*':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2b, '+':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2c, ',':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2d, '-':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2e, '.':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2f, '/':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x30, '0':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x31, '1':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x32, '2':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x33, '3':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x34, '4':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x35, '5':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x36, '6':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x37, '7':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x38, '8':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x39, '9':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3a, ':':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3b, ';':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3c, '<':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3d, '=':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3e, '>':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x3f, '?':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-// Character 0x40, '@':
-	0b011110001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000011100,
-	0b000000011100,
-	0b001111111000,
-	0b001111111000,
-	0b001111110000,
-	0b001111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x41, 'A':
-	0b111111111100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x42, 'B':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x43, 'C':
-	0b000000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x44, 'D':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x45, 'E':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x46, 'F':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x47, 'G':
-	0b111100001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x48, 'H':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x49, 'I':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4a, 'J':
-	0b110000000000,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4b, 'K':
-	0b000111001100,
-	0b001110001100,
-	0b001110001100,
-	0b011100001100,
-	0b011100001100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4c, 'L':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4d, 'M':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4e, 'N':
-	0b111100001100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4f, 'O':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x50, 'P':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x51, 'Q':
-	0b110111001100,
-	0b001110001100,
-	0b001110001100,
-	0b011100011100,
-	0b011100011100,
-	0b111011111000,
-	0b111011111000,
-	0b110111110000,
-	0b110011110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x52, 'R':
-	0b000111001100,
-	0b001110001100,
-	0b001110001100,
-	0b011100001100,
-	0b011100001100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x53, 'S':
-	0b110000000000,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x54, 'T':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x55, 'U':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x56, 'V':
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x57, 'W':
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111111100,
-	0b111111111100,
-	0b011111111000,
-	0b011111111000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x58, 'X':
-	0b011100111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x59, 'Y':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5a, 'Z':
-	0b000000111000,
-	0b000000011100,
-	0b000000011100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5b, '[':
-	0b000001110000,
-	0b000011100000,
-	0b000011100000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5c, '\':
-	0b011111001100,
-	0b111000000000,
-	0b111000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011000000,
-	0b000011000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5d, ']':
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5e, '^':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5f, '_':
-	0b111111111100,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x60, '`':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x61, 'a':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x62, 'b':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x63, 'c':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x64, 'd':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x65, 'e':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x66, 'f':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x67, 'g':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x68, 'h':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x69, 'i':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6a, 'j':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6b, 'k':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6c, 'l':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6d, 'm':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6e, 'n':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x6f, 'o':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-// Character 0x70, 'p':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x71, 'q':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x72, 'r':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x73, 's':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x74, 't':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x75, 'u':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x76, 'v':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x77, 'w':
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b000000111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x78, 'x':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x79, 'y':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7a, 'z':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7b, '{':
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7c, '|':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7d, '}':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7e, '~':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-// Character 0x7f, '':
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-	0b111111111111,
-};
-
-const uint16_t font_sep_graphic[96 * 20] = {
-// Character 0x20, ' ':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x21, '!':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x22, '"':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x23, '#':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x24, '$':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x25, '%':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x26, '&':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x27, ''':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x28, '(':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x29, ')':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2a, '*':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2b, '+':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2c, ',':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2d, '-':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2e, '.':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2f, '/':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x30, '0':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x31, '1':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x32, '2':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x33, '3':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x34, '4':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x35, '5':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x36, '6':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x37, '7':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x38, '8':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x39, '9':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3a, ':':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3b, ';':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3c, '<':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3d, '=':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3e, '>':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3f, '?':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x40, '@':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b111110001100,
-	0b111111001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111001100,
-	0b011110001100,
-	0b000000001100,
-	0b000000011100,
-	0b001111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x41, 'A':
-	0b000011000000,
-	0b000111100000,
-	0b001111110000,
-	0b011100111000,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x42, 'B':
-	0b001111111100,
-	0b011111111100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b011111111100,
-	0b001111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x43, 'C':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x44, 'D':
-	0b001111111100,
-	0b011111111100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b011111111100,
-	0b001111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x45, 'E':
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x46, 'F':
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x47, 'G':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111100001100,
-	0b111100001100,
-	0b110000001100,
-	0b110000011100,
-	0b111111111000,
-	0b111111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x48, 'H':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x49, 'I':
-	0b001111110000,
-	0b001111110000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b001111110000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4a, 'J':
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000001100,
-	0b111000011100,
-	0b011111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4b, 'K':
-	0b110000001100,
-	0b111000001100,
-	0b011100001100,
-	0b001110001100,
-	0b000111001100,
-	0b000011101100,
-	0b000001111100,
-	0b000001111100,
-	0b000011101100,
-	0b000111001100,
-	0b001110001100,
-	0b011100001100,
-	0b111000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4c, 'L':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4d, 'M':
-	0b110000001100,
-	0b111000011100,
-	0b111100111100,
-	0b111111111100,
-	0b110111101100,
-	0b110011001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4e, 'N':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000111100,
-	0b110001111100,
-	0b110011101100,
-	0b110111001100,
-	0b111110001100,
-	0b111100001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4f, 'O':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x50, 'P':
-	0b001111111100,
-	0b011111111100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b011111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x51, 'Q':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110111001100,
-	0b001110001100,
-	0b011100011100,
-	0b111011111000,
-	0b110011110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x52, 'R':
-	0b001111111100,
-	0b011111111100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b011111111100,
-	0b001111111100,
-	0b000011101100,
-	0b000111001100,
-	0b001110001100,
-	0b011100001100,
-	0b111000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x53, 'S':
-	0b001111110000,
-	0b011111111000,
-	0b111000011100,
-	0b110000001100,
-	0b000000001100,
-	0b000000011100,
-	0b001111111000,
-	0b011111110000,
-	0b111000000000,
-	0b110000000000,
-	0b110000001100,
-	0b111000011100,
-	0b011111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x54, 'T':
-	0b111111111100,
-	0b111111111100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x55, 'U':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011111111000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x56, 'V':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011100111000,
-	0b001100110000,
-	0b001100110000,
-	0b001111110000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x57, 'W':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111111100,
-	0b011111111000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x58, 'X':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011100111000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b011100111000,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x59, 'Y':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b011100111000,
-	0b001111110000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5a, 'Z':
-	0b111111111100,
-	0b111111111100,
-	0b110000000000,
-	0b111000000000,
-	0b011100000000,
-	0b001110000000,
-	0b000111000000,
-	0b000011100000,
-	0b000001110000,
-	0b000000111000,
-	0b000000011100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5b, '[':
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011100000,
-	0b000001110000,
-	0b000000111000,
-	0b111111111100,
-	0b111111111100,
-	0b000000111000,
-	0b000001110000,
-	0b000011100000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5c, '\':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111001100,
-	0b011111001100,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b001110000000,
-	0b000111000000,
-	0b000011000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5d, ']':
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000111000000,
-	0b001110000000,
-	0b011100000000,
-	0b111111111100,
-	0b111111111100,
-	0b011100000000,
-	0b001110000000,
-	0b000111000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5e, '^':
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b111011011100,
-	0b110011001100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5f, '_':
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b111111111100,
-	0b111111111100,
-	0b001100110000,
-	0b001100110000,
-	0b111111111100,
-	0b111111111100,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x60, '`':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x61, 'a':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x62, 'b':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x63, 'c':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x64, 'd':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x65, 'e':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x66, 'f':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x67, 'g':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x68, 'h':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x69, 'i':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6a, 'j':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6b, 'k':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6c, 'l':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6d, 'm':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6e, 'n':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6f, 'o':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x70, 'p':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x71, 'q':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x72, 'r':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x73, 's':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x74, 't':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x75, 'u':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x76, 'v':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x77, 'w':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x78, 'x':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x79, 'y':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7a, 'z':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7b, '{':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7c, '|':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7d, '}':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7e, '~':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7f, '':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-};
-
-const uint16_t font_sep_graphic_dh_upper[96 * 20] = {
-// Character 0x20, ' ':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x21, '!':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x22, '"':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x23, '#':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x24, '$':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x25, '%':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x26, '&':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x27, ''':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x28, '(':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x29, ')':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x2a, '*':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x2b, '+':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x2c, ',':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x2d, '-':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x2e, '.':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x2f, '/':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x30, '0':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x31, '1':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x32, '2':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x33, '3':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x34, '4':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x35, '5':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x36, '6':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x37, '7':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x38, '8':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x39, '9':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x3a, ':':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x3b, ';':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x3c, '<':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x3d, '=':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x3e, '>':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x3f, '?':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x40, '@':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b111110001100,
-	0b111110001100,
-	0b111111001100,
-	0b111111001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111001100,
-	0b111111001100,
-	0b011110001100,
-	0b011110001100,
-// Character 0x41, 'A':
-	0b000011000000,
-	0b000011000000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011100111000,
-	0b011100111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-// Character 0x42, 'B':
-	0b001111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x43, 'C':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x44, 'D':
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x45, 'E':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x46, 'F':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b001111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x47, 'G':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111100001100,
-	0b111100001100,
-	0b111100001100,
-	0b111100001100,
-// Character 0x48, 'H':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x49, 'I':
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x4a, 'J':
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-	0b110000000000,
-// Character 0x4b, 'K':
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011100001100,
-	0b011100001100,
-	0b001110001100,
-	0b001110001100,
-	0b000111001100,
-	0b000111001100,
-	0b000011101100,
-	0b000011101100,
-	0b000001111100,
-	0b000001111100,
-	0b000001111100,
-	0b000001111100,
-	0b000011101100,
-	0b000011101100,
-	0b000111001100,
-	0b000111001100,
-// Character 0x4c, 'L':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x4d, 'M':
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b111100111100,
-	0b111100111100,
-	0b111111111100,
-	0b111111111100,
-	0b110111101100,
-	0b110111101100,
-	0b110011001100,
-	0b110011001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x4e, 'N':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b110000111100,
-	0b110000111100,
-	0b110001111100,
-	0b110001111100,
-	0b110011101100,
-	0b110011101100,
-	0b110111001100,
-	0b110111001100,
-	0b111110001100,
-	0b111110001100,
-	0b111100001100,
-	0b111100001100,
-// Character 0x4f, 'O':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x50, 'P':
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-// Character 0x51, 'Q':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110011001100,
-	0b110111001100,
-	0b110111001100,
-// Character 0x52, 'R':
-	0b000111111100,
-	0b001111111100,
-	0b011111111100,
-	0b011111111100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b001111111100,
-	0b000011101100,
-	0b000011101100,
-	0b000111001100,
-	0b000111001100,
-// Character 0x53, 'S':
-	0b000111100000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000011100,
-	0b000000111100,
-	0b000011111000,
-	0b001111111000,
-	0b011111110000,
-	0b011111000000,
-	0b111100000000,
-	0b111000000000,
-	0b110000000000,
-	0b110000000000,
-// Character 0x54, 'T':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x55, 'U':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-// Character 0x56, 'V':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001111110000,
-	0b001111110000,
-// Character 0x57, 'W':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-// Character 0x58, 'X':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001111110000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011100111000,
-	0b011100111000,
-// Character 0x59, 'Y':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011100111000,
-	0b011100111000,
-	0b001111110000,
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x5a, 'Z':
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b110000000000,
-	0b110000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-// Character 0x5b, '[':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011100000,
-	0b000011100000,
-	0b000001110000,
-	0b000001110000,
-	0b000000111000,
-	0b000000111000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000111000,
-	0b000000111000,
-	0b000001110000,
-	0b000001110000,
-// Character 0x5c, '\':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b001111001100,
-	0b001111001100,
-	0b011111001100,
-	0b011111001100,
-// Character 0x5d, ']':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000111000000,
-	0b000111000000,
-	0b001110000000,
-	0b001110000000,
-	0b011100000000,
-	0b011100000000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-// Character 0x5e, '^':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000011000000,
-	0b000011000000,
-	0b000111100000,
-	0b000111100000,
-	0b001111110000,
-	0b001111110000,
-	0b011111111000,
-	0b011111111000,
-	0b111011011100,
-	0b111011011100,
-	0b110011001100,
-	0b110011001100,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-// Character 0x5f, '_':
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-// Character 0x60, '`':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x61, 'a':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x62, 'b':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x63, 'c':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x64, 'd':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x65, 'e':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x66, 'f':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x67, 'g':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x68, 'h':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x69, 'i':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x6a, 'j':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x6b, 'k':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x6c, 'l':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x6d, 'm':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x6e, 'n':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x6f, 'o':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x70, 'p':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x71, 'q':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x72, 'r':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x73, 's':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x74, 't':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x75, 'u':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x76, 'v':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x77, 'w':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x78, 'x':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x79, 'y':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x7a, 'z':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x7b, '{':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x7c, '|':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x7d, '}':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x7e, '~':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-// Character 0x7f, '':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-};
-
-const uint16_t font_sep_graphic_dh_lower[96 * 20] = {
-// Character 0x20, ' ':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x21, '!':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x22, '"':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x23, '#':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x24, '$':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x25, '%':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x26, '&':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x27, ''':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x28, '(':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x29, ')':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2a, '*':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2b, '+':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2c, ',':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2d, '-':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2e, '.':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x2f, '/':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x30, '0':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x31, '1':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x32, '2':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x33, '3':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x34, '4':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x35, '5':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x36, '6':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x37, '7':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x38, '8':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x39, '9':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3a, ':':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3b, ';':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3c, '<':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3d, '=':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3e, '>':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x3f, '?':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-// Character 0x40, '@':
-	0b011110001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000011100,
-	0b000000011100,
-	0b001111111000,
-	0b001111111000,
-	0b001111110000,
-	0b001111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x41, 'A':
-	0b111111111100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x42, 'B':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x43, 'C':
-	0b000000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x44, 'D':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000001100,
-	0b111000001100,
-	0b011111111100,
-	0b011111111100,
-	0b001111111100,
-	0b000111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x45, 'E':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x46, 'F':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x47, 'G':
-	0b111100001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000011100,
-	0b110000011100,
-	0b111111111000,
-	0b111111111000,
-	0b111111110000,
-	0b111111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x48, 'H':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x49, 'I':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b001111110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4a, 'J':
-	0b110000000000,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4b, 'K':
-	0b000111001100,
-	0b001110001100,
-	0b001110001100,
-	0b011100001100,
-	0b011100001100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4c, 'L':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4d, 'M':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4e, 'N':
-	0b111100001100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x4f, 'O':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x50, 'P':
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x51, 'Q':
-	0b110111001100,
-	0b001110001100,
-	0b001110001100,
-	0b011100011100,
-	0b011100011100,
-	0b111011111000,
-	0b111011111000,
-	0b110111110000,
-	0b110011110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x52, 'R':
-	0b000111001100,
-	0b001110001100,
-	0b001110001100,
-	0b011100001100,
-	0b011100001100,
-	0b111000001100,
-	0b111000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x53, 'S':
-	0b110000000000,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x54, 'T':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x55, 'U':
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b111000011100,
-	0b111000011100,
-	0b011111111000,
-	0b011111111000,
-	0b001111110000,
-	0b000111100000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x56, 'V':
-	0b001111110000,
-	0b000111100000,
-	0b000111100000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x57, 'W':
-	0b110011001100,
-	0b110011001100,
-	0b110011001100,
-	0b111111111100,
-	0b111111111100,
-	0b011111111000,
-	0b011111111000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x58, 'X':
-	0b011100111000,
-	0b111000011100,
-	0b111000011100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b110000001100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x59, 'Y':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5a, 'Z':
-	0b000000111000,
-	0b000000011100,
-	0b000000011100,
-	0b000000001100,
-	0b000000001100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b111111111100,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5b, '[':
-	0b000001110000,
-	0b000011100000,
-	0b000011100000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5c, '\':
-	0b011111001100,
-	0b111000000000,
-	0b111000000000,
-	0b111000000000,
-	0b111000000000,
-	0b011100000000,
-	0b011100000000,
-	0b001110000000,
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011000000,
-	0b000011000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b111111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5d, ']':
-	0b001110000000,
-	0b000111000000,
-	0b000111000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5e, '^':
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000011000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x5f, '_':
-	0b111111111100,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b001100110000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x60, '`':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x61, 'a':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x62, 'b':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x63, 'c':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x64, 'd':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x65, 'e':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x66, 'f':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x67, 'g':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x68, 'h':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x69, 'i':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6a, 'j':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6b, 'k':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6c, 'l':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6d, 'm':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6e, 'n':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x6f, 'o':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-// Character 0x70, 'p':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x71, 'q':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x72, 'r':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x73, 's':
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x74, 't':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x75, 'u':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x76, 'v':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x77, 'w':
-	0b000000011111,
-	0b000000011111,
-	0b000000011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x78, 'x':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x79, 'y':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7a, 'z':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7b, '{':
-	0b011111000000,
-	0b011111000000,
-	0b011111000000,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7c, '|':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7d, '}':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7e, '~':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-// Character 0x7f, '':
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b011111011111,
-	0b000000000000,
-	0b000000000000,
-	0b000000000000,
-};
-
@@ -0,0 +1,156 @@
+
+#include "frame.h"
+#include "mock_fifo.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+void frame_clear(frame_t *frame)
+{
+	memset(frame, 0, sizeof(*frame));
+}
+
+// Get ready for the words of a field starting on row first_row (0 for
+// the odd field, 1 for the even field) of each line.
+void frame_start_field(frame_t *frame, unsigned first_row)
+{
+	frame->border = VERTICAL_POS;
+	frame->row = first_row;
+	frame->x = 0;
+}
+
+// A mock_fifo_sink_t that interprets each word the way the mode7_output
+// PIO program does, with ctx the frame_t to draw in.
+void frame_sink(uint32_t word, void *ctx)
+{
+	frame_t *frame = ctx;
+	unsigned pixels;
+
+	if (MODE7_WORD_TYPE(word) == MODE7_WORD_EOL)
+	{
+		// End of line: the top border is all blank lines
+		if (frame->border != 0) frame->border--;
+		else
+		{
+			frame->row += 2;
+			frame->x = 0;
+		}
+		return;
+	}
+
+	pixels = mock_fifo_word_cells(word, SYSCLK_MHZ) * 12;
+	if ((pixels == 0) || (frame->border != 0)
+		|| (frame->row >= FRAME_HEIGHT) || (frame->x + pixels > FRAME_WIDTH))
+	{
+		frame->errors++;
+		return;
+	}
+
+	switch (MODE7_WORD_TYPE(word))
+	{
+		case MODE7_WORD_RUN:
+			// Cells all in one colour, which the PIO keeps as the
+			// background
+			frame->bg = (word >> 5) & 7;
+			memset(&frame->pixels[frame->row][frame->x], frame->bg, pixels);
+			frame->x += pixels;
+			return;
+		case MODE7_WORD_CELL:
+			frame->bg = (word >> 5) & 7;
+			frame->fg = (word >> 11) & 7;
+			word >>= 17;
+			break;
+		case MODE7_WORD_PAIR:
+			word >>= 5;
+			break;
+	}
+
+	// Pixels are sent LSB first, selecting the foreground colour or
+	// the background
+	for (unsigned u = 0; u < pixels; u++)
+	{
+		frame->pixels[frame->row][frame->x++]
+			= (word & (1 << u)) ? frame->fg : frame->bg;
+	}
+}
+
+bool frame_write_ppm(const frame_t *frame, const char *path)
+{
+	FILE *f;
+	bool ok;
+
+	f = fopen(path, "wb");
+	if (f == NULL) return false;
+	fprintf(f, "P6\n%u %u\n255\n", FRAME_WIDTH, FRAME_HEIGHT);
+	for (unsigned y = 0; y < FRAME_HEIGHT; y++)
+	{
+		for (unsigned x = 0; x < FRAME_WIDTH; x++)
+		{
+			unsigned colour = frame->pixels[y][x];
+
+			putc((colour & 1) ? 255 : 0, f);
+			putc((colour & 2) ? 255 : 0, f);
+			putc((colour & 4) ? 255 : 0, f);
+		}
+	}
+	ok = !ferror(f);
+	if (fclose(f) != 0) ok = false;
+	return ok;
+}
+
+// Read back a PPM written by frame_write_ppm().  Returns false if it's
+// missing or isn't a frame.
+bool frame_read_ppm(frame_t *frame, const char *path)
+{
+	FILE *f;
+	unsigned width, height, maxval;
+	bool ok;
+
+	f = fopen(path, "rb");
+	if (f == NULL) return false;
+	ok = (fscanf(f, "P6 %u %u %u", &width, &height, &maxval) == 3)
+		&& (width == FRAME_WIDTH) && (height == FRAME_HEIGHT)
+		&& (maxval == 255) && (getc(f) == '\n');
+	frame_clear(frame);
+	for (unsigned y = 0; ok && (y < FRAME_HEIGHT); y++)
+	{
+		for (unsigned x = 0; ok && (x < FRAME_WIDTH); x++)
+		{
+			unsigned colour = 0;
+
+			for (unsigned bit = 1; bit < 8; bit <<= 1)
+			{
+				int c = getc(f);
+
+				if (c == EOF) ok = false;
+				else if (c != 0) colour |= bit;
+			}
+			frame->pixels[y][x] = colour;
+		}
+	}
+	fclose(f);
+	return ok;
+}
+
+// Returns the number of pixels that differ, and the position of the
+// first one.
+unsigned frame_compare(const frame_t *a, const frame_t *b,
+	unsigned *first_x, unsigned *first_y)
+{
+	unsigned diffs = 0;
+
+	for (unsigned y = 0; y < FRAME_HEIGHT; y++)
+	{
+		for (unsigned x = 0; x < FRAME_WIDTH; x++)
+		{
+			if (a->pixels[y][x] == b->pixels[y][x]) continue;
+			if (diffs++ == 0)
+			{
+				*first_x = x;
+				*first_y = y;
+			}
+		}
+	}
+	return diffs;
+}
@@ -0,0 +1,38 @@
+// Reconstruction of the picture from the words sent to the PIO, for the
+// host build.  A frame is built up from an odd and an even field.
+
+#ifndef FRAME_H
+#define FRAME_H
+
+#include "mode7_render.h"
+
+// 40 characters of 12 pixels, 25 lines of ROWS_PER_LINE scanlines
+#define	FRAME_WIDTH		(40 * 12)
+#define	FRAME_HEIGHT	(25 * ROWS_PER_LINE)
+
+typedef struct
+{
+	// Colour of each pixel as output on the RGB pins: bit 0 red,
+	// bit 1 green, bit 2 blue.
+	uint8_t pixels[FRAME_HEIGHT][FRAME_WIDTH];
+
+	// Position in the field being received
+	unsigned border;		// End of lines still expected for the top border
+	unsigned row, x;
+
+	// Colours the PIO has, for pairs of cells
+	unsigned bg, fg;
+
+	// Words that didn't fit the picture
+	unsigned errors;
+} frame_t;
+
+extern void frame_clear(frame_t *frame);
+extern void frame_start_field(frame_t *frame, unsigned first_row);
+extern void frame_sink(uint32_t word, void *ctx);
+extern bool frame_write_ppm(const frame_t *frame, const char *path);
+extern bool frame_read_ppm(frame_t *frame, const char *path);
+extern unsigned frame_compare(const frame_t *a, const frame_t *b,
+	unsigned *first_x, unsigned *first_y);
+
+#endif
@@ -0,0 +1,90 @@
+
+#include "mock_fifo.h"
+
+#define	FNV_OFFSET		2166136261u
+#define	FNV_PRIME		16777619u
+
+static mock_fifo_stats_t fifo_stats = { .digest = FNV_OFFSET };
+static mock_fifo_sink_t fifo_sink;
+static void *fifo_sink_ctx;
+
+
+// Forget everything written so far
+void mock_fifo_reset(void)
+{
+	fifo_stats = (mock_fifo_stats_t){ .digest = FNV_OFFSET };
+}
+
+// Pass each word on to sink as well (NULL for none)
+void mock_fifo_set_sink(mock_fifo_sink_t sink, void *ctx)
+{
+	fifo_sink = sink;
+	fifo_sink_ctx = ctx;
+}
+
+// Equivalent of pio_sm_put_blocking() to the mode7_output state machine.
+// The FIFO never fills, as nothing is taking words out at a fixed rate.
+void mock_fifo_put(uint32_t word)
+{
+	fifo_stats.words++;
+	switch (MODE7_WORD_TYPE(word))
+	{
+		case MODE7_WORD_EOL:
+			fifo_stats.eols++;
+			break;
+		case MODE7_WORD_RUN:
+			fifo_stats.runs++;
+			fifo_stats.run_cells += mock_fifo_word_cells(word, SYSCLK_MHZ);
+			break;
+		case MODE7_WORD_PAIR:
+			fifo_stats.pairs++;
+			break;
+	}
+	for (unsigned u = 0; u < 32; u += 8)
+	{
+		fifo_stats.digest = (fifo_stats.digest ^ ((word >> u) & 0xff))
+			* FNV_PRIME;
+	}
+	if (fifo_sink) fifo_sink(word, fifo_sink_ctx);
+}
+
+// A mode7_output_fn that queues the scanline in the FIFO, as the
+// non-DMA output_scanline() in mode7.c does.
+void mock_fifo_output(unsigned scanline, const uint32_t *words,
+	unsigned count, bool last)
+{
+	unsigned cells = 0;
+	bool ok, have_colours = false;
+
+	// The words must add up to the 40 cells of the line, and the last
+	// be the end-of-line marker.  A pair can only come after a cell
+	// word has set the foreground colour, as the scanlines don't always
+	// go out in the same order.
+	ok = (count >= 2) && (count <= WORDS_PER_LINE)
+		&& (words[count - 1] == MODE7_EOL(SYSCLK_MHZ));
+	for (unsigned u = 0; ok && (u < count - 1); u++)
+	{
+		unsigned n = mock_fifo_word_cells(words[u], SYSCLK_MHZ);
+
+		if (MODE7_WORD_TYPE(words[u]) == MODE7_WORD_CELL)
+			have_colours = true;
+		else if ((MODE7_WORD_TYPE(words[u]) == MODE7_WORD_PAIR)
+			&& !have_colours)
+		{
+			ok = false;
+		}
+		if (n == 0) ok = false;
+		cells += n;
+	}
+	if (cells != 40) ok = false;
+
+	fifo_stats.scanlines++;
+	if (!ok) fifo_stats.bad_scanlines++;
+	for (unsigned u = 0; u < count; u++)
+		mock_fifo_put(words[u]);
+}
+
+void mock_fifo_get_stats(mock_fifo_stats_t *stats)
+{
+	*stats = fifo_stats;
+}
@@ -0,0 +1,53 @@
+// Stand-in for the TX FIFO of the mode7_output state machine, for the
+// host build.  Words written to it are checked, counted and hashed, and
+// can also be passed on to a sink (eg. to reconstruct the picture).
+// The words are expected to be for a PIO clock of SYSCLK_MHZ, which is
+// what the host programs give mode7_render_init().
+
+#ifndef MOCK_FIFO_H
+#define MOCK_FIFO_H
+
+#include "mode7_render.h"
+
+// The number of cells a word (see mode7.pio) for the given PIO clock
+// covers, or 0 for the end of line marker or a word that isn't valid.
+static inline unsigned mock_fifo_word_cells(uint32_t word, unsigned pio_mhz)
+{
+	unsigned cycles;
+
+	switch (MODE7_WORD_TYPE(word))
+	{
+		case MODE7_WORD_CELL:
+			return (word >> 29) ? 0 : 1;
+		case MODE7_WORD_PAIR:
+			return (word >> 29) ? 0 : 2;
+		case MODE7_WORD_RUN:
+			cycles = ((word >> 11) & 0xfff) + MODE7_RUN_OVERHEAD;
+			if ((word >> 23) || (cycles % pio_mhz)) return 0;
+			return cycles / pio_mhz;
+	}
+	return 0;
+}
+
+typedef void (*mock_fifo_sink_t)(uint32_t word, void *ctx);
+
+typedef struct
+{
+	unsigned words;				// Words written to the FIFO
+	unsigned eols;				// ... of which end-of-line markers
+	unsigned runs;				// ... runs of blank cells
+	unsigned run_cells;			// ... (cells sent as runs)
+	unsigned pairs;				// ... and pairs of cells
+	unsigned scanlines;			// Scanlines queued by mock_fifo_output()
+	unsigned bad_scanlines;		// ... that weren't 40 cells and an EOL
+	uint32_t digest;			// FNV-1a hash of all the words
+} mock_fifo_stats_t;
+
+extern void mock_fifo_reset(void);
+extern void mock_fifo_set_sink(mock_fifo_sink_t sink, void *ctx);
+extern void mock_fifo_put(uint32_t word);
+extern void mock_fifo_output(unsigned scanline, const uint32_t *words,
+	unsigned count, bool last);
+extern void mock_fifo_get_stats(mock_fifo_stats_t *stats);
+
+#endif
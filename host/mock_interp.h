@@ -0,0 +1,88 @@
+// Model of the SIO interpolator for the host build, with just what
+// mode7_render.c uses: the shift, mask and cross input of lanes 0 and 1,
+// and the FULL result.  The registers are as wide as a pointer, so that
+// glyph addresses come out right on a 64-bit PC.
+
+#ifndef MOCK_INTERP_H
+#define MOCK_INTERP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct
+{
+	unsigned shift, mask_lsb, mask_msb;
+	bool cross_input;
+} interp_config;
+
+typedef struct
+{
+	interp_config ctrl[2];
+	uintptr_t accum[2];
+	uintptr_t base[3];
+} interp_hw_t;
+
+// Only ever used by the one core there is
+static interp_hw_t mock_interp0;
+#define	interp0		(&mock_interp0)
+
+static inline interp_config interp_default_config(void)
+{
+	return (interp_config){ 0, 0, 31, false };
+}
+
+static inline void interp_config_set_shift(interp_config *c, unsigned shift)
+{
+	c->shift = shift;
+}
+
+static inline void interp_config_set_mask(interp_config *c,
+	unsigned mask_lsb, unsigned mask_msb)
+{
+	c->mask_lsb = mask_lsb;
+	c->mask_msb = mask_msb;
+}
+
+static inline void interp_config_set_cross_input(interp_config *c,
+	bool cross_input)
+{
+	c->cross_input = cross_input;
+}
+
+static inline void interp_set_config(interp_hw_t *interp, unsigned lane,
+	interp_config *config)
+{
+	interp->ctrl[lane] = *config;
+}
+
+static inline void interp_set_base(interp_hw_t *interp, unsigned lane,
+	uintptr_t val)
+{
+	interp->base[lane] = val;
+}
+
+static inline void interp_set_accumulator(interp_hw_t *interp,
+	unsigned lane, uintptr_t val)
+{
+	interp->accum[lane] = val;
+}
+
+// A lane's accumulator (or the other lane's, if crossed over), shifted
+// right and masked
+static inline uintptr_t mock_interp_lane(const interp_hw_t *interp,
+	unsigned lane)
+{
+	const interp_config *c = &interp->ctrl[lane];
+	uintptr_t in = interp->accum[c->cross_input ? lane ^ 1 : lane];
+
+	return (in >> c->shift)
+		& (((uintptr_t)2 << c->mask_msb) - ((uintptr_t)1 << c->mask_lsb));
+}
+
+static inline uintptr_t interp_peek_full_result(interp_hw_t *interp)
+{
+	return interp->base[2] + mock_interp_lane(interp, 0)
+		+ mock_interp_lane(interp, 1);
+}
+
+#endif
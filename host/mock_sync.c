@@ -0,0 +1,55 @@
+
+#include "mock_sync.h"
+#include "mock_fifo.h"
+
+#include <string.h>
+
+// Parity of successive fields: 'o' for odd, 'e' for even.  Real video
+// alternates, but a script can also repeat a parity, as happens when a
+// field's VSYNC is missed.
+static const char *sync_script = "oe";
+static unsigned sync_pos;
+
+
+// Set the sequence of field parities, which is repeated once used up.
+// Characters other than 'o' and 'e' are ignored.  Returns false (and
+// leaves the script as it was) if there aren't any.
+bool mock_sync_set_script(const char *script)
+{
+	if (strpbrk(script, "oe") == NULL) return false;
+	sync_script = script;
+	sync_pos = 0;
+	return true;
+}
+
+// Equivalent of wait_for_vsync(): feeds the lines of the top border into
+// the FIFO, and returns true if it's the odd field, false if even field.
+bool mock_wait_for_vsync(void)
+{
+	char c;
+
+	do
+	{
+		c = sync_script[sync_pos++];
+		if (c == '\0') sync_pos = 0;
+	} while ((c != 'o') && (c != 'e'));
+
+	for (unsigned u = 0; u < VERTICAL_POS; u++)
+		mock_fifo_put(MODE7_EOL(SYSCLK_MHZ));
+	return c == 'o';
+}
+
+// Equivalent of mode7_display_field() with the rendering done on the
+// same core: the words go to the mock FIFO.
+void mock_display_field(const mode7_page_t *page, bool flash_on)
+{
+	unsigned first_row;
+
+	page = mode7_page_snapshot(page);
+
+	// Start on row 0 or 1 depending on whether this is odd or even field
+	if (mock_wait_for_vsync()) first_row = 0;
+	else first_row = 1;
+
+	mode7_render_field(page, flash_on, first_row, mock_fifo_output, NULL);
+}
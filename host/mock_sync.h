@@ -0,0 +1,13 @@
+// Scripted sync source for the host build, standing in for the sync input
+// and wait_for_vsync() in mode7.c.
+
+#ifndef MOCK_SYNC_H
+#define MOCK_SYNC_H
+
+#include "mode7_render.h"
+
+extern bool mock_sync_set_script(const char *script);
+extern bool mock_wait_for_vsync(void);
+extern void mock_display_field(const mode7_page_t *page, bool flash_on);
+
+#endif
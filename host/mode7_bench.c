@@ -0,0 +1,231 @@
+// Benchmark of the per-field rendering, over the test pages, synthetic
+// worst-case pages and random pages.  Each field is rendered with the
+// line cache flushed, so every line is decoded and every scanline
+// generated, and then again as a steady state display with the cache in
+// use.  The page corpus is fixed, so runs are comparable.
+// Usage: mode7_bench [fields-per-page [random-pages]]
+
+#include "mode7_render.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define	DEFAULT_FIELDS		200
+#define	DEFAULT_RANDOM		64
+
+// As main.c: rate of flashing, as a count of 50Hz fields on and off
+#define	FLASH_RATE			16
+
+// Field times for one group of pages, in ns
+typedef struct
+{
+	const char *name;
+	uint32_t *times;
+	unsigned count;
+	uint64_t decode_ns, row_ns;
+} sample_t;
+
+// A group of pages in the corpus
+typedef struct
+{
+	const char *name;
+	unsigned first, count;
+} group_t;
+
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// Repeatable pseudo-random numbers, so the corpus is the same every run
+static uint32_t rand_state = 1;
+
+static unsigned next_rand(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (rand_state >> 16) & 0x7fff;
+}
+
+
+// Every cell a control code, cycling through all 32 so that each line
+// changes colour, graphics, hold, flash, conceal and height throughout.
+static void make_control_page(uint8_t *page)
+{
+	for (unsigned u = 0; u < PAGE_BYTES; u++)
+		page[u] = (u * 7) & 0x1f;
+}
+
+// Hold graphics runs: mosaics alternating with colour changes, so every
+// control code cell shows the held mosaic, switching between contiguous
+// and separated.
+static void make_hold_page(uint8_t *page)
+{
+	static const uint8_t pattern[] = {
+		0x1e, 0x7f, 0x12, 0x35, 0x1a, 0x13, 0x6a, 0x14,
+		0x19, 0x7b, 0x15, 0x2c, 0x16, 0x1f, 0x17, 0x1e
+	};
+
+	for (unsigned u = 0; u < PAGE_BYTES; u++)
+		page[u] = pattern[u % sizeof(pattern)];
+	for (unsigned line = 0; line < 25; line++)
+		page[line * 40] = 0x17;
+}
+
+// Double height flashing text on every line, with a mixture of alpha
+// and mosaic characters.
+static void make_dh_flash_page(uint8_t *page)
+{
+	for (unsigned u = 0; u < PAGE_BYTES; u++)
+	{
+		switch (u % 40)
+		{
+			case 0:		page[u] = 0x0d;		break;
+			case 1:		page[u] = 0x08;		break;
+			case 20:	page[u] = 0x16;		break;
+			default:	page[u] = 0x20 + (u % 96);	break;
+		}
+	}
+}
+
+static int compare_times(const void *a, const void *b)
+{
+	uint32_t ta = *(const uint32_t *)a, tb = *(const uint32_t *)b;
+
+	return (ta > tb) - (ta < tb);
+}
+
+// Display a number of fields of each page, alternating odd/even and
+// changing the flash phase every FLASH_RATE fields as the display does,
+// and record the time for each field.
+static void run(sample_t *s, uint8_t (*pages)[PAGE_BYTES], unsigned n,
+	unsigned fields, bool flush)
+{
+	mode7_cache_stats_t cs;
+
+	s->count = 0;
+	s->decode_ns = s->row_ns = 0;
+	for (unsigned p = 0; p < n; p++)
+	{
+		for (unsigned f = 0; f < fields; f++)
+		{
+			const mode7_page_t *page;
+			uint64_t start;
+
+			if (flush) mode7_flush_line_cache();
+			start = now_ns();
+			page = mode7_page_snapshot(&MODE7_PAGE(pages[p]));
+			mode7_render_field(page, (f / FLASH_RATE) & 1, f & 1, NULL,
+				NULL);
+			s->times[s->count++] = now_ns() - start;
+
+			mode7_get_cache_stats(&cs);
+			s->decode_ns += cs.decode_cycles;
+			s->row_ns += cs.row_cycles;
+		}
+	}
+}
+
+static void report(const sample_t *s, uint32_t *sorted)
+{
+	uint64_t total = 0;
+	double field;
+
+	memcpy(sorted, s->times, s->count * sizeof(*sorted));
+	qsort(sorted, s->count, sizeof(*sorted), compare_times);
+	for (unsigned u = 0; u < s->count; u++) total += sorted[u];
+	field = (double)total / s->count;
+
+	// A field is 25 lines of 40 cells, and half the rows of each
+	printf("%-16s %9.0f %9.1f %7.2f %7.2f %7.2f %9u %9u %9u %9u\n",
+		s->name, field, field / (25 * ROWS_PER_LINE / 2),
+		field / (25 * 40),
+		(double)s->decode_ns / s->count / (25 * 40),
+		(double)s->row_ns / s->count / (25 * ROWS_PER_LINE / 2 * 40),
+		sorted[s->count / 2], sorted[s->count * 90 / 100],
+		sorted[s->count * 99 / 100], sorted[s->count - 1]);
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned fields_per_page = DEFAULT_FIELDS;
+	unsigned random_pages = DEFAULT_RANDOM;
+	uint8_t (*pages)[PAGE_BYTES];
+	uint32_t *times, *sorted;
+	unsigned n_pages, u;
+	group_t groups[5];
+	unsigned n_groups = 0;
+
+	if (argc > 1) fields_per_page = strtoul(argv[1], NULL, 0);
+	if (argc > 2) random_pages = strtoul(argv[2], NULL, 0);
+	if (fields_per_page == 0)
+	{
+		fprintf(stderr, "Usage: %s [fields-per-page [random-pages]]\n",
+			argv[0]);
+		return 2;
+	}
+
+	n_pages = NOOF_TEST_PAGES + 3 + random_pages;
+	pages = malloc(n_pages * sizeof(*pages));
+	times = malloc(n_pages * fields_per_page * sizeof(*times));
+	sorted = malloc(n_pages * fields_per_page * sizeof(*sorted));
+	if ((pages == NULL) || (times == NULL) || (sorted == NULL)) return 1;
+
+	n_pages = 0;
+	groups[n_groups++] = (group_t){ "test pages", n_pages,
+		NOOF_TEST_PAGES };
+	for (u = 0; u < NOOF_TEST_PAGES; u++)
+		memcpy(pages[n_pages++], test_pages[u], PAGE_BYTES);
+	groups[n_groups++] = (group_t){ "control codes", n_pages, 1 };
+	make_control_page(pages[n_pages++]);
+	groups[n_groups++] = (group_t){ "hold graphics", n_pages, 1 };
+	make_hold_page(pages[n_pages++]);
+	groups[n_groups++] = (group_t){ "double/flash", n_pages, 1 };
+	make_dh_flash_page(pages[n_pages++]);
+	if (random_pages != 0)
+	{
+		groups[n_groups++] = (group_t){ "random", n_pages,
+			random_pages };
+		for (u = 0; u < random_pages; u++)
+			for (unsigned b = 0; b < PAGE_BYTES; b++)
+				pages[n_pages][b] = next_rand() & 0xff;
+		n_pages += random_pages;
+	}
+
+	mode7_render_init(SYSCLK_MHZ);
+	mode7_render_core_init();
+
+	printf("%u fields per page; times in ns\n", fields_per_page);
+	for (unsigned cached = 0; cached < 2; cached++)
+	{
+		printf("\n%s\n", cached ? "Steady state, with the line cache:"
+			: "Every line rendered:");
+		printf("%-16s %9s %9s %7s %7s %7s %9s %9s %9s %9s\n",
+			"pages", "field", "scanline", "cell", "decode", "pixels",
+			"p50", "p90", "p99", "max");
+		for (u = 0; u < n_groups; u++)
+		{
+			sample_t s = { .name = groups[u].name, .times = times };
+
+			// Warm up, then time it
+			run(&s, &pages[groups[u].first], groups[u].count,
+				(fields_per_page + 7) / 8, !cached);
+			run(&s, &pages[groups[u].first], groups[u].count,
+				fields_per_page, !cached);
+			report(&s, sorted);
+		}
+	}
+	printf("\nfield/scanline/cell: mean time for the whole field divided by"
+		" its 250 scanlines\nor 1000 cells.  decode: attribute decoding per"
+		" cell.  pixels: generating\none cell's word for one scanline."
+		"  p50..max: field time percentiles.\n");
+	free(pages);
+	free(times);
+	free(sorted);
+	return 0;
+}
@@ -0,0 +1,529 @@
+// Replays a trace of Electron bus cycles through the bus_capture PIO
+// program from mode7.pio in the simulator, with a model of the DMA that
+// copies what it captures into the page buffer (see buscapture.c), and
+// displays fields of the page as it goes through the same decoder as the
+// demo.  Every access to &7C00-&7FFF in the trace must come out of the
+// capture, in order; and the page must end up as the writes in the trace
+// left it.
+// Usage: mode7_busreplay [-c sysclk-mhz] [-d dma-cycles] [-o image.ppm]
+//                        [-w trace-out] [-m] [trace]
+//  -c  System clock the PIO runs at (default SYSCLK_MHZ)
+//  -d  clk_sys cycles the DMA takes for each word (default 5)
+//  -o  Write the last frame displayed to a PPM image
+//  -w  Write the trace replayed to a file (eg. the built-in one)
+//  -m  Find the fastest bus clock at which the capture keeps up with a
+//      write to the screen on every cycle
+// With no trace, replays a built-in one of a copy loop writing the first
+// test page to the screen, plus a write to the screen on every cycle at
+// the Electron's 2MHz.
+// Exits with status 1 if anything was missed or captured wrongly.
+//
+// A trace is a text file with one bus cycle per line:
+//   time address data r|w
+// with the time of the start of the cycle in ns, and the address and data
+// in hex.  Each cycle lasts until the start of the next (500ns for the
+// last), with phi0 high for the second half.  Blank lines and anything
+// after a '#' are ignored.
+
+#include "frame.h"
+#include "mock_fifo.h"
+#include "mock_sync.h"
+#include "pio_sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Timing of the bus, for a 6502 at 2MHz: the address is valid from
+// ADDR_NS after the start of the cycle, the data from DATA_NS after phi0
+// rises, and both are held for HOLD_NS after the end of the cycle (the
+// 6502's minimum, tAH and tHW).  The
+// 74LVC245 buffers take BUFFER_NS to drive the AD pins once enabled.
+// At any other time the pins have the inverse of what the PIO wants, so
+// reading them too early or late shows up as a wrong byte.
+#define	ADDR_NS			100
+#define	DATA_NS			100
+#define	HOLD_NS			30
+#define	BUFFER_NS		8
+
+// Side-set values for the SEL pins (as in mode7.pio)
+#define	SEL_DT			6
+#define	SEL_AH			5
+#define	SEL_AL			3
+
+#define	SCREEN_BASE		0x7c00
+#define	IN_SCREEN(addr)	(((addr) & 0xfc00) == SCREEN_BASE)
+
+// Where the page buffer is, for the addresses the PIO makes
+#define	PAGE_ADDR		0x20040000u
+
+// Fields are displayed every 20ms of the trace
+#define	FIELD_NS		20000000ull
+
+typedef struct
+{
+	uint64_t time;			// Start of the cycle, in ns
+	uint16_t addr;
+	uint8_t data;
+	bool write;
+} bus_cycle_t;
+
+// One access to the screen
+typedef struct
+{
+	uint16_t offset;
+	uint8_t data;
+} access_t;
+
+static bus_cycle_t *trace;
+static unsigned trace_len, trace_max;
+
+// What the capture should come up with, and what it did
+static access_t *expected, *captured;
+static unsigned n_expected, n_captured;
+
+static int sysclk_mhz = SYSCLK_MHZ;
+static unsigned dma_cycles = 5;
+
+// State of the simulated bus
+static struct
+{
+	unsigned cur;				// Cycle of the trace last looked at
+	struct
+	{
+		uint64_t cycle;			// PIO cycle the SEL pins last changed
+		unsigned value;
+	} sel[2];					// The latest change, and the one before
+} bus;
+
+static uint8_t page[1024];
+static frame_t frame;
+
+
+static bool add_cycle(uint64_t time, unsigned addr, unsigned data,
+	bool write)
+{
+	if (trace_len == trace_max)
+	{
+		trace_max = trace_max ? trace_max * 2 : 4096;
+		trace = realloc(trace, trace_max * sizeof(*trace));
+		if (trace == NULL) return false;
+	}
+	trace[trace_len++] = (bus_cycle_t){ time, addr, data, write };
+	return true;
+}
+
+static bool read_trace(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char line[256], rw;
+	unsigned long long time;
+	unsigned addr, data, line_no = 0;
+
+	if (f == NULL)
+	{
+		perror(path);
+		return false;
+	}
+	while (fgets(line, sizeof(line), f) != NULL)
+	{
+		char *hash = strchr(line, '#');
+
+		line_no++;
+		if (hash != NULL) *hash = '\0';
+		if (strspn(line, " \t\r\n") == strlen(line)) continue;
+		if ((sscanf(line, "%llu %x %x %c", &time, &addr, &data, &rw) != 4)
+			|| (addr > 0xffff) || (data > 0xff)
+			|| ((rw != 'r') && (rw != 'w') && (rw != 'R') && (rw != 'W'))
+			|| ((trace_len != 0) && (time <= trace[trace_len - 1].time)))
+		{
+			fprintf(stderr, "%s:%u: bad bus cycle\n", path, line_no);
+			fclose(f);
+			return false;
+		}
+		if (!add_cycle(time, addr, data, (rw == 'w') || (rw == 'W')))
+			return false;
+	}
+	fclose(f);
+	return true;
+}
+
+static bool write_trace(const char *path)
+{
+	FILE *f = fopen(path, "w");
+
+	if (f == NULL)
+	{
+		perror(path);
+		return false;
+	}
+	fprintf(f, "# time(ns) address data r/w\n");
+	for (unsigned u = 0; u < trace_len; u++)
+		fprintf(f, "%llu %04x %02x %c\n",
+			(unsigned long long)trace[u].time, trace[u].addr,
+			trace[u].data, trace[u].write ? 'w' : 'r');
+	return fclose(f) == 0;
+}
+
+
+// The built-in trace.  Memory is modelled just enough for the reads of
+// the screen to give what was last written there.
+static uint8_t screen_mem[1024];
+
+static void gen_cycle(uint64_t *time, unsigned ns, unsigned addr,
+	unsigned data, bool write)
+{
+	if (IN_SCREEN(addr))
+	{
+		if (write) screen_mem[addr - SCREEN_BASE] = data;
+		else data = screen_mem[addr - SCREEN_BASE];
+	}
+	add_cycle(*time, addr, data, write);
+	*time += ns;
+}
+
+// The Electron runs the CPU at 2MHz from ROM, and 1MHz from RAM
+#define	ROM_NS		500
+#define	RAM_NS		1000
+
+// A copy of page to the screen by the usual loop, cycle by cycle:
+//   loop: LDA (&70),Y : STA (&72),Y : INY : BNE loop
+// with a write just outside the screen at each end, and to addresses that
+// only differ from it in A14 or A15, to check the filter.
+static void gen_copy(uint64_t *time, const uint8_t *src)
+{
+	const unsigned code = 0xc000, from = 0x3000;
+
+	memset(screen_mem, ' ', sizeof(screen_mem));
+	gen_cycle(time, RAM_NS, 0x7bff, 0x55, true);
+	gen_cycle(time, RAM_NS, 0xfc00, 0xaa, true);
+	gen_cycle(time, RAM_NS, 0x3c00, 0xaa, true);
+	for (unsigned u = 0; u < PAGE_BYTES; u++)
+	{
+		unsigned y = u & 0xff, base = u & ~0xff;
+
+		// LDA (&70),Y
+		gen_cycle(time, ROM_NS, code, 0xb1, false);
+		gen_cycle(time, ROM_NS, code + 1, 0x70, false);
+		gen_cycle(time, RAM_NS, 0x70, (from + base) & 0xff, false);
+		gen_cycle(time, RAM_NS, 0x71, (from + base) >> 8, false);
+		gen_cycle(time, RAM_NS, from + u, src[u], false);
+		// STA (&72),Y, with the dummy read of the screen before the write
+		gen_cycle(time, ROM_NS, code + 2, 0x91, false);
+		gen_cycle(time, ROM_NS, code + 3, 0x72, false);
+		gen_cycle(time, RAM_NS, 0x72, (SCREEN_BASE + base) & 0xff, false);
+		gen_cycle(time, RAM_NS, 0x73, (SCREEN_BASE + base) >> 8, false);
+		gen_cycle(time, RAM_NS, SCREEN_BASE + u, 0, false);
+		gen_cycle(time, RAM_NS, SCREEN_BASE + u, src[u], true);
+		// INY, BNE loop
+		gen_cycle(time, ROM_NS, code + 4, 0xc8, false);
+		gen_cycle(time, ROM_NS, code + 5, 0xd0, false);
+		gen_cycle(time, ROM_NS, code + 5, 0xd0, false);
+		gen_cycle(time, ROM_NS, code + 6, 0xf5, false);
+		gen_cycle(time, ROM_NS, code + 7, y, false);
+	}
+	gen_cycle(time, RAM_NS, 0x8000, 0x55, true);
+	gen_cycle(time, RAM_NS, 0x7fff, 0x55, true);
+}
+
+// A write to the screen on every cycle, at the given bus clock (in kHz),
+// which is more than a 6502 can do.  Each is a different byte, so a
+// missed one shows.
+static void gen_stress(uint64_t *time, unsigned khz, unsigned cycles)
+{
+	unsigned ns = 1000000 / khz;
+
+	for (unsigned u = 0; u < cycles; u++)
+		gen_cycle(time, ns, SCREEN_BASE + (u * 7) % 1024, u & 0xff, true);
+}
+
+
+// Pin inputs for the PIO, at the time of the cycle
+
+static unsigned sel_at(uint64_t cycle)
+{
+	unsigned i = (cycle >= bus.sel[0].cycle) ? 0 : 1;
+	uint64_t settle = (BUFFER_NS * sysclk_mhz + 999) / 1000;
+
+	// Nothing valid on the pins until the buffer has had time to drive
+	// them
+	if (cycle < bus.sel[i].cycle + settle) return 0;
+	return bus.sel[i].value;
+}
+
+static bool bus_pin(void *ctx, uint64_t cycle, unsigned pin)
+{
+	uint64_t t = cycle * 1000 / sysclk_mhz, start, end, rise;
+	const bus_cycle_t *c, *prev;
+	unsigned value;
+	bool valid;
+
+	if (trace_len == 0) return true;
+
+	// Find the cycle of the trace at the time
+	while ((bus.cur + 1 < trace_len) && (t >= trace[bus.cur + 1].time))
+		bus.cur++;
+	while ((bus.cur > 0) && (t < trace[bus.cur].time))
+		bus.cur--;
+	c = &trace[bus.cur];
+	prev = (bus.cur > 0) ? c - 1 : c;
+	start = c->time;
+	end = (bus.cur + 1 < trace_len) ? c[1].time : start + 500;
+	rise = start + (end - start) / 2;
+
+	if (pin == PIN_O0) return (t >= start) && (t >= rise) && (t < end);
+	if ((pin < PIN_AD_BASE) || (pin >= PIN_AD_BASE + 8)) return true;
+
+	switch (sel_at(cycle))
+	{
+		case SEL_AH:
+		case SEL_AL:
+			if (t < start + HOLD_NS) c = prev;
+			valid = (t < start) || (t < start + HOLD_NS)
+				|| (t >= start + ADDR_NS);
+			value = (sel_at(cycle) == SEL_AH) ? c->addr >> 8 : c->addr;
+			break;
+		case SEL_DT:
+			if (t < start + HOLD_NS) c = prev;
+			valid = (t < start + HOLD_NS) || (t >= rise + DATA_NS);
+			value = c->data;
+			break;
+		default:
+			// Floating, or two buffers enabled
+			valid = false;
+			value = 0;
+			break;
+	}
+	if (!valid) value = ~value;
+	return (value >> (pin - PIN_AD_BASE)) & 1;
+}
+
+static void sel_out(void *ctx, uint64_t cycle, uint32_t value)
+{
+	if (value != bus.sel[0].value)
+	{
+		bus.sel[1] = bus.sel[0];
+		bus.sel[0].cycle = cycle;
+		bus.sel[0].value = value;
+	}
+}
+
+
+// Display a field of the page as it is now, alternating the parity
+static void display_field(unsigned field)
+{
+	frame_start_field(&frame, field & 1);
+	mock_sync_set_script((field & 1) ? "e" : "o");
+	mock_display_field(&MODE7_PAGE(page), false);
+}
+
+// Replay the trace from the start.  Returns true if the capture got every
+// access to the screen right.
+static bool replay(const char *path, bool quiet)
+{
+	pio_sim_program_t prog;
+	pio_sim_sm_t sm;
+	char err[256];
+	uint64_t end_ns, next_field = FIELD_NS;
+	unsigned dma_busy = 0, fields = 0, wrong = 0;
+	uint32_t word, dma_addr = 0;
+	bool have_addr = false;
+	uint8_t reference[1024];
+	bool written[1024] = { false };
+
+	if (!pio_sim_assemble(path, "bus_capture", sysclk_mhz, &prog, err,
+		sizeof(err)))
+	{
+		printf("%s\n", err);
+		return false;
+	}
+
+	// What the capture should see: every access to the screen, in order,
+	// though only the writes decide what the page should end up as
+	expected = realloc(expected, (trace_len + 1) * sizeof(*expected));
+	captured = realloc(captured, (trace_len + 1) * sizeof(*captured));
+	if ((expected == NULL) || (captured == NULL)) return false;
+	n_expected = n_captured = 0;
+	for (unsigned u = 0; u < trace_len; u++)
+	{
+		unsigned offset = trace[u].addr & 0x3ff;
+
+		if (!IN_SCREEN(trace[u].addr)) continue;
+		expected[n_expected++] = (access_t){ offset, trace[u].data };
+		if (trace[u].write)
+		{
+			reference[offset] = trace[u].data;
+			written[offset] = true;
+		}
+	}
+
+	// As bus_capture_init()
+	pio_sim_init(&sm, &prog, 0);
+	sm.in_base = PIN_AD_BASE;
+	sm.jmp_pin = PIN_O0;
+	sm.in_shift_right = false;
+	sm.autopush = true;
+	sm.push_threshold = 32;
+	sm.fifo_depth = 8;
+	sm.y = PAGE_ADDR >> 10;
+	sm.pin_in = bus_pin;
+	sm.sideset_out = sel_out;
+	memset(&bus, 0, sizeof(bus));
+
+	memset(page, ' ', sizeof(page));
+	frame_clear(&frame);
+	mock_fifo_reset();
+	mock_fifo_set_sink(frame_sink, &frame);
+
+	end_ns = trace_len ? trace[trace_len - 1].time + 1000 : 0;
+	while ((sm.cycle * 1000 / sysclk_mhz < end_ns) || (sm.rx_level != 0)
+		|| (dma_busy != 0))
+	{
+		pio_sim_step(&sm);
+
+		// The address channel and then the data channel each take a
+		// word when they're free
+		if (dma_busy != 0) dma_busy--;
+		else if (pio_sim_get(&sm, &word))
+		{
+			dma_busy = dma_cycles;
+			if (!have_addr) dma_addr = word;
+			else if ((dma_addr >> 10) != (PAGE_ADDR >> 10))
+				wrong++;
+			else
+			{
+				page[dma_addr & 0x3ff] = word;
+				if (n_captured < trace_len)
+					captured[n_captured++] = (access_t){
+						dma_addr & 0x3ff, word & 0xff };
+			}
+			have_addr = !have_addr;
+		}
+
+		if (sm.cycle * 1000 / sysclk_mhz >= next_field)
+		{
+			display_field(fields++);
+			next_field += FIELD_NS;
+		}
+	}
+	// And show how it ended up
+	display_field(fields++);
+	display_field(fields++);
+	mock_fifo_set_sink(NULL, NULL);
+
+	for (unsigned u = 0; u < n_captured && u < n_expected; u++)
+	{
+		if ((captured[u].offset != expected[u].offset)
+			|| (captured[u].data != expected[u].data))
+		{
+			if (wrong++ == 0)
+				printf("Access %u to the screen captured as &%04x=%02x, "
+					"should be &%04x=%02x\n", u,
+					SCREEN_BASE + captured[u].offset, captured[u].data,
+					SCREEN_BASE + expected[u].offset, expected[u].data);
+		}
+	}
+	for (unsigned u = 0; u < 1024; u++)
+	{
+		if (written[u] && (page[u] != reference[u]))
+		{
+			if (wrong++ == 0)
+				printf("&%04x ended up %02x, should be %02x\n",
+					SCREEN_BASE + u, page[u], reference[u]);
+		}
+	}
+
+	if (!quiet || (wrong != 0) || (n_captured != n_expected))
+	{
+		mock_fifo_stats_t fs;
+
+		mock_fifo_get_stats(&fs);
+		printf("%u bus cycles over %.3fms at %dMHz: %u accesses to the "
+			"screen, %u captured, %u wrong\n", trace_len,
+			(double)end_ns / 1e6, sysclk_mhz, n_expected, n_captured,
+			wrong);
+		printf("PIO stalled on a full FIFO for %u cycles\n", sm.rxstalls);
+		printf("%u fields displayed, digest %08x\n", fields, fs.digest);
+	}
+	return (wrong == 0) && (n_captured == n_expected);
+}
+
+// Find the fastest bus clock at which a write on every cycle is all
+// captured
+static bool max_rate(const char *path)
+{
+	unsigned khz, best = 0;
+	uint64_t time;
+
+	for (khz = 1000; khz <= 16000; khz += 250)
+	{
+		trace_len = 0;
+		time = 0;
+		gen_stress(&time, khz, 2000);
+		if (!replay(path, true)) break;
+		best = khz;
+	}
+	if (best == 0)
+	{
+		printf("Doesn't keep up at %uMHz\n", khz / 1000);
+		return false;
+	}
+	printf("Keeps up with a write to the screen on every cycle up to "
+		"%.2fMHz at %dMHz, DMA %u cycles a word\n", best / 1000.0,
+		sysclk_mhz, dma_cycles);
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *path = MODE7_PIO_PATH, *image = NULL, *trace_out = NULL;
+	bool find_max = false, ok;
+	uint64_t time = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "c:d:o:w:mf:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'c':	sysclk_mhz = atoi(optarg);				break;
+			case 'd':	dma_cycles = strtoul(optarg, NULL, 0);	break;
+			case 'o':	image = optarg;							break;
+			case 'w':	trace_out = optarg;						break;
+			case 'm':	find_max = true;						break;
+			case 'f':	path = optarg;							break;
+			default:
+				fprintf(stderr, "Usage: %s [-c sysclk-mhz] [-d dma-cycles] "
+					"[-o image.ppm] [-w trace-out] [-m] [trace]\n", argv[0]);
+				return 2;
+		}
+	}
+	if (sysclk_mhz <= 0)
+	{
+		fprintf(stderr, "Bad clock speed\n");
+		return 2;
+	}
+
+	mode7_render_init(SYSCLK_MHZ);
+
+	if (find_max) return max_rate(path) ? 0 : 1;
+
+	if (optind < argc)
+	{
+		if (!read_trace(argv[optind])) return 2;
+	}
+	else
+	{
+		gen_copy(&time, test_pages[0]);
+		gen_stress(&time, 2000, 2000);
+	}
+	if ((trace_out != NULL) && !write_trace(trace_out)) return 2;
+
+	ok = replay(path, false);
+	if ((image != NULL) && !frame_write_ppm(&frame, image))
+	{
+		fprintf(stderr, "Can't write %s\n", image);
+		return 2;
+	}
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+// Displays fields of the test pages on the mock FIFO, the same way the
+// demo does, and prints a digest of the words the PIO would have been
+// sent along with the line cache statistics.
+// Usage: mode7_fields [fields [sync-script]]
+// The script is the parity of successive fields, eg. "oe" (the default)
+// or "ooe" to have a repeated field.
+
+#include "mock_fifo.h"
+#include "mock_sync.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// As main.c: rate of flashing, as a count of 50Hz fields on and off
+#define	FLASH_RATE		16
+// Rate of switching between the demo images
+#define	CAROUSEL_RATE	(5*50)
+
+
+int main(int argc, char *argv[])
+{
+	unsigned carousel_count = 0, flash_count = 0;
+	bool flash_on = false;
+	unsigned page_no = 0;
+	unsigned fields, field;
+	mode7_cache_stats_t cs;
+	mock_fifo_stats_t fs;
+	uint64_t render_cycles = 0, lookup_cycles = 0;
+
+	fields = (argc > 1) ? strtoul(argv[1], NULL, 0)
+		: NOOF_TEST_PAGES * (CAROUSEL_RATE + 1);
+	if ((argc > 2) && !mock_sync_set_script(argv[2]))
+	{
+		fprintf(stderr, "Sync script must contain 'o' and/or 'e'\n");
+		return 2;
+	}
+
+	mode7_render_init(SYSCLK_MHZ);
+	mode7_render_core_init();
+	mock_fifo_reset();
+
+	for (field = 0; field < fields; field++)
+	{
+		mock_display_field(&MODE7_PAGE(test_pages[page_no]), flash_on);
+		mode7_get_cache_stats(&cs);
+		render_cycles += cs.render_cycles;
+		lookup_cycles += cs.lookup_cycles;
+
+		if (flash_count++ >= FLASH_RATE)
+		{
+			flash_on = !flash_on;
+			flash_count = 0;
+		}
+		if (carousel_count++ >= CAROUSEL_RATE)
+		{
+			carousel_count = 0;
+			page_no++;
+			if (page_no >= NOOF_TEST_PAGES) page_no = 0;
+		}
+	}
+
+	mock_fifo_get_stats(&fs);
+	printf("Fields:         %u\n", fields);
+	printf("FIFO words:     %u (%u end of line, %u runs of %u cells, "
+		"%u pairs)\n", fs.words, fs.eols, fs.runs, fs.run_cells, fs.pairs);
+	printf("Scanlines:      %u (%u malformed)\n", fs.scanlines,
+		fs.bad_scanlines);
+	printf("Digest:         %08x\n", fs.digest);
+	printf("Cache:          %u hits, %u misses\n", cs.total_hits,
+		cs.total_misses);
+	if (fields != 0)
+	{
+		printf("Render:         %llu ns/field\n",
+			(unsigned long long)(render_cycles / fields));
+		printf("Lookup:         %llu ns/field\n",
+			(unsigned long long)(lookup_cycles / fields));
+	}
+	return (fs.bad_scanlines != 0) ? 1 : 0;
+}
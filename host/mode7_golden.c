@@ -0,0 +1,294 @@
+// Golden image regression test: renders pages through the same decoder,
+// line cache and scanline path as the display, rebuilds the interlaced
+// picture from the words that would go to the PIO, and compares it with
+// the images checked in under golden/, for both flash phases.  Each page
+// is also displayed scrolled round its window, from a table of lines
+// scattered about, and as a view of a wider surface, all of which must
+// look the same.
+// Usage: mode7_golden [-u] [-o dir] golden-dir [page-dir...]
+// The test pages are always checked, as test_page0..3, plus any 1000-byte
+// files in the page directories (named after the file).  Images are
+// golden-dir/<name>_flash_on.ppm and <name>_flash_off.ppm.
+//  -u      Write the images to golden-dir rather than checking them
+//  -o dir  Write the images that don't match to dir, for inspection
+
+#include "frame.h"
+#include "mock_fifo.h"
+#include "mock_sync.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static bool update;
+static const char *golden_dir;
+static const char *failed_dir;
+
+static frame_t frame, replay, wrapped, scattered, view, golden;
+
+// Where the page goes in the window to check the wraparound: part way
+// through a line, so that line is split across the end of the window
+#define	WRAP_START		(PAGE_WINDOW - 12 * 40 - 17)
+static uint8_t window[PAGE_WINDOW];
+
+// Lines of the page in reverse order, with a gap between each, to check
+// displaying from a table of lines
+static uint8_t scatter[25][48];
+static const uint8_t *scatter_lines[25];
+
+// A surface 80 characters wide, with the page in the bottom half
+#define	SURFACE_WIDTH	80
+static uint8_t surface[50][SURFACE_WIDTH];
+static unsigned checked, failed;
+
+
+// Display an odd and an even field of the page into frame
+static void render_frame(const mode7_page_t *page, bool flash_on,
+	frame_t *frame)
+{
+	frame_clear(frame);
+	mock_fifo_set_sink(frame_sink, frame);
+
+	frame_start_field(frame, 0);
+	mock_sync_set_script("o");
+	mock_display_field(page, flash_on);
+
+	frame_start_field(frame, 1);
+	mock_sync_set_script("e");
+	mock_display_field(page, flash_on);
+
+	mock_fifo_set_sink(NULL, NULL);
+}
+
+// Check the page displayed as a view of a wider surface.  Each line of
+// the page is there twice over, so panning right by some characters must
+// just move the picture left, with the attributes from the characters to
+// the left of the view still in effect.  Then the attributes to the left
+// are changed, which must make a difference even though the characters in
+// the view are the same.
+static bool check_views(const char *image, const uint8_t *page,
+	bool flash_on)
+{
+	static const unsigned pans[] = { 0, 1, 13, 27 };
+	unsigned diffs, x = 0, y = 0;
+
+	memset(surface, 'x', sizeof(surface));
+	for (unsigned line = 0; line < 25; line++)
+	{
+		memcpy(surface[25 + line], page + line * 40, 40);
+		memcpy(surface[25 + line] + 40, page + line * 40, 40);
+	}
+	for (unsigned u = 0; u < count_of(pans); u++)
+	{
+		unsigned pan = pans[u];
+
+		render_frame(&MODE7_VIEW(&surface[0][0], SURFACE_WIDTH, pan, 25),
+			flash_on, &view);
+		diffs = 0;
+		for (y = 0; y < FRAME_HEIGHT; y++)
+		{
+			for (x = 0; x < (40 - pan) * 12; x++)
+				if (view.pixels[y][x] != frame.pixels[y][x + pan * 12])
+					diffs++;
+		}
+		if (diffs != 0)
+		{
+			printf("%s: %u pixels differ in a view panned by %u\n",
+				image, diffs, pan);
+			return false;
+		}
+	}
+
+	// Mosaic red, new background, just to the left
+	for (unsigned line = 0; line < 25; line++)
+	{
+		memset(surface[25 + line], ' ', 40);
+		surface[25 + line][38] = 0x11;
+		surface[25 + line][39] = 0x1d;
+	}
+	render_frame(&MODE7_VIEW(&surface[0][0], SURFACE_WIDTH, 40, 25),
+		flash_on, &view);
+	if (frame_compare(&frame, &view, &x, &y) == 0)
+	{
+		printf("%s: attributes to the left of a view made no difference\n",
+			image);
+		return false;
+	}
+	for (unsigned line = 0; line < 25; line++)
+		surface[25 + line][38] = surface[25 + line][39] = ' ';
+	render_frame(&MODE7_VIEW(&surface[0][0], SURFACE_WIDTH, 40, 25),
+		flash_on, &view);
+	if ((diffs = frame_compare(&frame, &view, &x, &y)) != 0)
+	{
+		printf("%s: %u pixels differ in a view after the attributes to "
+			"the left changed, first at %u,%u\n", image, diffs, x, y);
+		return false;
+	}
+	return true;
+}
+
+// Render one page in one flash phase and check it against its golden
+// image (or update the golden image).
+static void check_page(const char *name, const uint8_t *page, bool flash_on)
+{
+	char path[1024], image[256];
+	unsigned diffs, x = 0, y = 0;
+
+	snprintf(image, sizeof(image), "%s_flash_%s.ppm", name,
+		flash_on ? "on" : "off");
+	snprintf(path, sizeof(path), "%s/%s", golden_dir, image);
+	checked++;
+
+	// Render it twice, the second time replayed from the line cache,
+	// which must make no difference; and again scrolled.
+	render_frame(&MODE7_PAGE(page), flash_on, &frame);
+	render_frame(&MODE7_PAGE(page), flash_on, &replay);
+	memset(window, 0, sizeof(window));
+	for (unsigned u = 0; u < PAGE_BYTES; u++)
+		window[(WRAP_START + u) % PAGE_WINDOW] = page[u];
+	render_frame(&(mode7_page_t){ window, WRAP_START, PAGE_WINDOW - 1, 40,
+		0, NULL }, flash_on, &wrapped);
+	for (unsigned line = 0; line < 25; line++)
+	{
+		memcpy(scatter[24 - line], page + line * 40, 40);
+		scatter_lines[line] = scatter[24 - line];
+	}
+	render_frame(&(mode7_page_t){ .lines = scatter_lines }, flash_on,
+		&scattered);
+	if (frame.errors != 0)
+	{
+		printf("%s: %u words didn't fit the picture\n", image, frame.errors);
+		failed++;
+	}
+	else if ((diffs = frame_compare(&frame, &replay, &x, &y)) != 0)
+	{
+		printf("%s: %u pixels differ when replayed from the cache, "
+			"first at %u,%u\n", image, diffs, x, y);
+		failed++;
+	}
+	else if ((diffs = frame_compare(&frame, &wrapped, &x, &y)) != 0)
+	{
+		printf("%s: %u pixels differ when wrapped round the window, "
+			"first at %u,%u\n", image, diffs, x, y);
+		failed++;
+	}
+	else if ((diffs = frame_compare(&frame, &scattered, &x, &y)) != 0)
+	{
+		printf("%s: %u pixels differ from a table of lines, "
+			"first at %u,%u\n", image, diffs, x, y);
+		failed++;
+	}
+	else if (!check_views(image, page, flash_on))
+		failed++;
+	else if (update)
+	{
+		if (!frame_write_ppm(&frame, path))
+		{
+			printf("%s: can't write\n", path);
+			failed++;
+		}
+		return;
+	}
+	else if (!frame_read_ppm(&golden, path))
+	{
+		printf("%s: no golden image\n", path);
+		failed++;
+	}
+	else if ((diffs = frame_compare(&frame, &golden, &x, &y)) != 0)
+	{
+		printf("%s: %u pixels differ, first at %u,%u (line %u row %u)\n",
+			image, diffs, x, y, y / ROWS_PER_LINE, y % ROWS_PER_LINE);
+		failed++;
+	}
+	else return;
+
+	if (failed_dir != NULL)
+	{
+		snprintf(path, sizeof(path), "%s/%s", failed_dir, image);
+		if (!frame_write_ppm(&frame, path))
+			printf("%s: can't write\n", path);
+	}
+}
+
+static int only_files(const struct dirent *ent)
+{
+	return ent->d_name[0] != '.';
+}
+
+// Check every 1000-byte file in a directory, in name order
+static void check_dir(const char *dir)
+{
+	struct dirent **list;
+	int n;
+
+	n = scandir(dir, &list, only_files, alphasort);
+	if (n < 0)
+	{
+		printf("%s: can't read directory\n", dir);
+		failed++;
+		return;
+	}
+	for (int i = 0; i < n; i++)
+	{
+		char path[1024], name[256], *dot;
+		uint8_t page[PAGE_BYTES + 1];
+		FILE *f;
+		size_t len;
+
+		snprintf(path, sizeof(path), "%s/%s", dir, list[i]->d_name);
+		f = fopen(path, "rb");
+		len = (f != NULL) ? fread(page, 1, sizeof(page), f) : 0;
+		if (f != NULL) fclose(f);
+		if (len == PAGE_BYTES)
+		{
+			snprintf(name, sizeof(name), "%s", list[i]->d_name);
+			if ((dot = strrchr(name, '.')) != NULL) *dot = '\0';
+			check_page(name, page, false);
+			check_page(name, page, true);
+		}
+		free(list[i]);
+	}
+	free(list);
+}
+
+int main(int argc, char *argv[])
+{
+	int opt;
+
+	while ((opt = getopt(argc, argv, "uo:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'u':	update = true;			break;
+			case 'o':	failed_dir = optarg;	break;
+			default:	return 2;
+		}
+	}
+	if (optind >= argc)
+	{
+		fprintf(stderr,
+			"Usage: %s [-u] [-o dir] golden-dir [page-dir...]\n", argv[0]);
+		return 2;
+	}
+	golden_dir = argv[optind++];
+
+	mode7_render_init(SYSCLK_MHZ);
+	mode7_render_core_init();
+
+	for (unsigned u = 0; u < NOOF_TEST_PAGES; u++)
+	{
+		char name[32];
+
+		snprintf(name, sizeof(name), "test_page%u", u);
+		check_page(name, test_pages[u], false);
+		check_page(name, test_pages[u], true);
+	}
+	while (optind < argc)
+		check_dir(argv[optind++]);
+
+	printf("%u images %s, %u failed\n", checked,
+		update ? "written" : "checked", failed);
+	return (failed != 0) ? 1 : 0;
+}
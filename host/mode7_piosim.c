@@ -0,0 +1,432 @@
+// Runs the mode7_output PIO program from mode7.pio in the simulator,
+// fed with a field of scanlines from the renderer and an HSYNC waveform,
+// and reports the timing of the pixels it outputs: the period of each
+// pixel by the route taken round the loop, the jitter between them, the
+// timing of the runs of blank cells, the line width and the back porch.
+// Each output is also checked against the colour it should be.
+// Usage: mode7_piosim [-v] [-f mode7.pio] [sysclk-mhz...]
+// The clock speeds are of the PIO, which mode7_init() always runs at a
+// multiple of 12MHz, dividing down the system clock if need be.  With
+// none given, tries each multiple of 12MHz from 96 to 144.
+// Exits with status 1 if any pixel is out of place or the wrong colour.
+
+#include "mode7_render.h"
+#include "pio_sim.h"
+#include "mock_fifo.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Pin numbers as in mode7.pio, relative to the mapping bases
+#define	SYNC_PIN		0
+
+#define	MAX_SCANLINES	(25 * ROWS_PER_LINE / 2)
+#define	PIXELS			(40 * 12)
+
+// What each output to the pins should be: a pixel of a cell or pair
+// word, either the first (after a refill of the OSR) or a later one
+// (after pad) and foreground or background; the start of a run; or the
+// black at the end of the line.
+#define	ROUTE_CELL		0
+#define	ROUTE_PAIR		2
+#define	ROUTE_PAD		4
+#define	ROUTE_BG		0
+#define	ROUTE_FG		1
+#define	N_ROUTES		6
+#define	KIND_RUN		6
+#define	KIND_EOL		7
+static const char * const route_names[N_ROUTES] = {
+	"cell, background", "cell, foreground",
+	"pair, background", "pair, foreground",
+	"pad, background", "pad, foreground"
+};
+
+typedef struct
+{
+	unsigned pos;			// Pixel position in the line, PIXELS for the EOL
+	uint8_t colour;
+	uint8_t kind;			// ROUTE_xxx | ROUTE_xx, or KIND_xxx
+} expect_t;
+
+// One output to the pins
+typedef struct
+{
+	uint64_t cycle;
+	uint32_t value;
+} event_t;
+
+// Timing of the sync input
+typedef struct
+{
+	uint64_t first_fall;		// Cycle of the first HSYNC
+	uint64_t line;				// Cycles per line
+	uint64_t low;				// Cycles of HSYNC
+} sync_wave_t;
+
+// Scanline words captured from the renderer
+static uint32_t field_words[MAX_SCANLINES][WORDS_PER_LINE];
+static unsigned field_counts[MAX_SCANLINES];
+static unsigned field_scanlines;
+
+// The words for the clock speed being simulated, and what each should
+// output
+static uint32_t sim_words[MAX_SCANLINES * WORDS_PER_LINE];
+static unsigned sim_line_start[MAX_SCANLINES + 1];
+static expect_t *expects;
+static unsigned expect_line_start[MAX_SCANLINES + 1];
+
+// The outputs to the pins
+static event_t *events;
+static unsigned n_events, max_events;
+
+static bool verbose;
+
+
+static void capture_scanline(unsigned scanline, const uint32_t *words,
+	unsigned count, bool last)
+{
+	if (scanline < MAX_SCANLINES)
+	{
+		memcpy(field_words[scanline], words, count * sizeof(words[0]));
+		field_counts[scanline] = count;
+	}
+	field_scanlines = scanline + 1;
+}
+
+static bool sync_pin(void *ctx, uint64_t cycle, unsigned pin)
+{
+	const sync_wave_t *wave = ctx;
+
+	if (pin != SYNC_PIN) return true;
+	if (cycle < wave->first_fall) return true;
+	return ((cycle - wave->first_fall) % wave->line) >= wave->low;
+}
+
+static void pixel_out(void *ctx, uint64_t cycle, uint32_t value)
+{
+	if (n_events < max_events)
+	{
+		events[n_events].cycle = cycle;
+		events[n_events].value = value;
+		n_events++;
+	}
+}
+
+// Add what the PIO should output for pixels of a cell or pair word
+static unsigned expect_pixels(unsigned n, uint32_t pixels, unsigned pos,
+	unsigned fg, unsigned bg, unsigned route, expect_t *x)
+{
+	for (unsigned i = 0; i < n; i++)
+	{
+		bool on = (pixels & (1 << i)) != 0;
+
+		x[i] = (expect_t){ pos + i, on ? fg : bg,
+			(i ? ROUTE_PAD : route) | (on ? ROUTE_FG : ROUTE_BG) };
+	}
+	return n;
+}
+
+// Render a field for the clock speed, into sim_words[], and work out what
+// the PIO should output for each word.
+static void render_field(int sysclk_mhz)
+{
+	unsigned n_words = 0, n_expects = 0, fg = 0, bg = 0;
+
+	// The first test page gives a good mixture of pixels
+	mode7_render_init(sysclk_mhz);
+	mode7_render_field(mode7_page_snapshot(&MODE7_PAGE(test_pages[0])),
+		true, 0, capture_scanline, NULL);
+
+	for (unsigned s = 0; s < field_scanlines; s++)
+	{
+		unsigned pos = 0;
+
+		sim_line_start[s] = n_words;
+		expect_line_start[s] = n_expects;
+		for (unsigned u = 0; u < field_counts[s]; u++)
+		{
+			uint32_t word = field_words[s][u];
+
+			sim_words[n_words++] = word;
+			switch (MODE7_WORD_TYPE(word))
+			{
+				case MODE7_WORD_EOL:
+					expects[n_expects++] = (expect_t){ pos, 0, KIND_EOL };
+					break;
+
+				case MODE7_WORD_CELL:
+					bg = (word >> 5) & 7;
+					fg = (word >> 11) & 7;
+					n_expects += expect_pixels(12, word >> 17, pos, fg, bg,
+						ROUTE_CELL, &expects[n_expects]);
+					pos += 12;
+					break;
+
+				case MODE7_WORD_PAIR:
+					n_expects += expect_pixels(24, word >> 5, pos, fg, bg,
+						ROUTE_PAIR, &expects[n_expects]);
+					pos += 24;
+					break;
+
+				case MODE7_WORD_RUN:
+					bg = (word >> 5) & 7;
+					expects[n_expects++] = (expect_t){ pos, bg, KIND_RUN };
+					pos += mock_fifo_word_cells(word, sysclk_mhz) * 12;
+					break;
+			}
+		}
+	}
+	sim_line_start[field_scanlines] = n_words;
+	expect_line_start[field_scanlines] = n_expects;
+}
+
+// Check that the word types used by the renderer are the addresses of the
+// right code
+static bool check_labels(const pio_sim_program_t *prog)
+{
+	static const struct
+	{
+		const char *label;
+		int value;
+	} words[] = {
+		{ "cell", MODE7_WORD_CELL }, { "pair", MODE7_WORD_PAIR },
+		{ "run", MODE7_WORD_RUN }, { "eol", MODE7_WORD_EOL }
+	};
+	bool ok = true;
+
+	for (unsigned u = 0; u < count_of(words); u++)
+	{
+		if (pio_sim_find_label(prog, words[u].label) != words[u].value)
+		{
+			printf("Label %s is at %d, not %d as the renderer expects\n",
+				words[u].label, pio_sim_find_label(prog, words[u].label),
+				words[u].value);
+			ok = false;
+		}
+	}
+	return ok;
+}
+
+typedef struct
+{
+	int min, max;
+	unsigned count;
+} range_t;
+
+static void range_add(range_t *r, int value)
+{
+	if ((r->count == 0) || (value < r->min)) r->min = value;
+	if ((r->count == 0) || (value > r->max)) r->max = value;
+	r->count++;
+}
+
+// Difference between the extremes of two ranges
+static unsigned spread(const range_t *a, const range_t *b)
+{
+	if (a->count == 0) return (b->count != 0) ? b->max - b->min : 0;
+	if (b->count == 0) return a->max - a->min;
+	return ((a->max > b->max) ? a->max : b->max)
+		- ((a->min < b->min) ? a->min : b->min);
+}
+
+// Simulate a field at one clock speed and report the timings.  Returns
+// true if every pixel takes the same time, and runs the time of their
+// cells.
+static bool simulate(const char *path, int sysclk_mhz)
+{
+	pio_sim_program_t prog;
+	pio_sim_sm_t sm;
+	sync_wave_t wave;
+	char err[256];
+	int entry;
+	uint32_t eol;
+	unsigned word_no, total_words, total_expects, ideal, fg_bg, boundary, u;
+	unsigned bad_colours = 0, worst_error = 0;
+	range_t routes[N_ROUTES] = { { 0 } }, all = { 0 }, porch = { 0 };
+	range_t width = { 0 };
+	range_t runs = { 0 };
+	bool ok;
+
+	if (!pio_sim_assemble(path, "mode7_output", sysclk_mhz, &prog,
+		err, sizeof(err)))
+	{
+		printf("%3dMHz: %s\n", sysclk_mhz, err);
+		return false;
+	}
+	entry = pio_sim_find_label(&prog, "entrypoint");
+	if (entry < 0)
+	{
+		printf("%3dMHz: no entrypoint\n", sysclk_mhz);
+		return false;
+	}
+	if (!check_labels(&prog)) return false;
+	if (verbose)
+	{
+		for (unsigned u = 0; u < prog.length; u++)
+		{
+			char buf[64];
+
+			pio_sim_disassemble(prog.code[u], buf, sizeof(buf));
+			printf("  %2u: %04x  %-24s [%u]\n", u, prog.code[u], buf,
+				(prog.code[u] >> 8) & 0x1f);
+		}
+	}
+
+	// As mode7_output_init(): OSR shifts right with a threshold of 29,
+	// no autopull, and the FIFOs joined.
+	pio_sim_init(&sm, &prog, entry);
+	sm.out_count = 3;
+	sm.out_shift_right = true;
+	sm.pull_threshold = 29;
+	sm.fifo_depth = 8;
+	sm.pin_in = sync_pin;
+	sm.pins_out = pixel_out;
+	sm.ctx = &wave;
+
+	// 64us lines with a 4.7us HSYNC, starting shortly after
+	wave.first_fall = sysclk_mhz * 10;
+	wave.line = sysclk_mhz * 64;
+	wave.low = sysclk_mhz * 47 / 10;
+
+	render_field(sysclk_mhz);
+	eol = MODE7_EOL(sysclk_mhz);
+	ideal = sysclk_mhz / 12;
+
+	// mode7_init() starts it off with an end of line, then the field
+	// goes in as fast as the FIFO takes it, as it would from DMA.
+	n_events = 0;
+	pio_sim_put(&sm, eol);
+	word_no = 0;
+	total_words = sim_line_start[field_scanlines];
+	total_expects = expect_line_start[field_scanlines];
+	while ((n_events < 1 + total_expects)
+		&& (sm.cycle < (field_scanlines + 2) * wave.line))
+	{
+		while (word_no < total_words)
+		{
+			if (!pio_sim_put(&sm, sim_words[word_no])) break;
+			word_no++;
+		}
+		pio_sim_step(&sm);
+	}
+	if (n_events < 1 + total_expects)
+	{
+		printf("%3dMHz: only %u of %u outputs\n", sysclk_mhz,
+			n_events, 1 + total_expects);
+		return false;
+	}
+
+	for (unsigned s = 0; s < field_scanlines; s++)
+	{
+		const expect_t *x = &expects[expect_line_start[s]];
+		const event_t *e = &events[1 + expect_line_start[s]];
+		unsigned n = expect_line_start[s + 1] - expect_line_start[s];
+
+		for (unsigned i = 0; i < n; i++)
+		{
+			uint64_t want = e[0].cycle + x[i].pos * ideal;
+			unsigned error = (e[i].cycle > want) ? e[i].cycle - want
+				: want - e[i].cycle;
+
+			if (error > worst_error) worst_error = error;
+			if ((e[i].value & 7) != x[i].colour) bad_colours++;
+			if (i == 0) continue;
+
+			if (x[i - 1].kind == KIND_RUN)
+			{
+				// Time for the run, less the time for its cells
+				range_add(&runs, (int)(e[i].cycle - e[i - 1].cycle)
+					- (int)((x[i].pos - x[i - 1].pos) * ideal));
+			}
+			else if (x[i].kind < N_ROUTES)
+			{
+				int period = e[i].cycle - e[i - 1].cycle;
+
+				range_add(&routes[x[i].kind], period);
+				range_add(&all, period);
+			}
+		}
+		range_add(&porch, e[0].cycle - (wave.first_fall + s * wave.line));
+		range_add(&width, e[n - 1].cycle - e[0].cycle);
+	}
+
+	ok = (all.min == all.max) && (all.min == (int)ideal) && (worst_error == 0)
+		&& (bad_colours == 0);
+	printf("%3dMHz: delay [%u], %u cycles per pixel wanted, got %d..%d%s\n",
+		sysclk_mhz, (prog.code[pio_sim_find_label(&prog, "do_out")] >> 8)
+		& 0x1f, ideal, all.min, all.max, ok ? "" : "  *** JITTER ***");
+	for (unsigned r = 0; r < N_ROUTES; r++)
+	{
+		if (routes[r].count == 0) continue;
+		printf("        %-24s %d..%d cycles (%u pixels)\n", route_names[r],
+			routes[r].min, routes[r].max, routes[r].count);
+	}
+	if (runs.count != 0)
+	{
+		printf("        %-24s %+d..%+d cycles out (%u runs)\n",
+			"end of run", runs.min, runs.max, runs.count);
+	}
+	fg_bg = boundary = 0;
+	for (unsigned r = 0; r < N_ROUTES; r += 2)
+	{
+		u = spread(&routes[r | ROUTE_BG], &routes[r | ROUTE_FG]);
+		if (u > fg_bg) fg_bg = u;
+		if (r == ROUTE_PAD) continue;
+		u = spread(&routes[r | ROUTE_FG], &routes[ROUTE_PAD | ROUTE_FG]);
+		if (u > boundary) boundary = u;
+	}
+	printf("        foreground/background jitter %u cycles, "
+		"word boundary jitter %u cycles\n", fg_bg, boundary);
+	printf("        worst error from the ideal pixel time %u cycles, "
+		"%u wrong colours\n", worst_error, bad_colours);
+	printf("        line %.3f..%.3fus (40us wanted), pixel clock %.3fMHz\n",
+		(double)width.min / sysclk_mhz, (double)width.max / sysclk_mhz,
+		(double)PIXELS * sysclk_mhz / width.max);
+	printf("        HSYNC to first pixel %.3f..%.3fus "
+		"(BACK_PORCH is %.1fus)\n", (double)porch.min / sysclk_mhz,
+		(double)porch.max / sysclk_mhz, 17.2);
+	return ok;
+}
+
+int main(int argc, char *argv[])
+{
+	static const int default_clocks[] = { 96, 108, 120, 132, 144 };
+	const char *path = MODE7_PIO_PATH;
+	bool ok = true;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "vf:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'v':	verbose = true;	break;
+			case 'f':	path = optarg;	break;
+			default:
+				fprintf(stderr, "Usage: %s [-v] [-f mode7.pio] "
+					"[sysclk-mhz...]\n", argv[0]);
+				return 2;
+		}
+	}
+
+	// At most one output per pixel, plus the end of line
+	max_events = 1 + MAX_SCANLINES * (PIXELS + 1);
+	events = malloc(max_events * sizeof(*events));
+	expects = malloc(max_events * sizeof(*expects));
+	if ((events == NULL) || (expects == NULL)) return 1;
+
+	if (optind < argc)
+	{
+		for (; optind < argc; optind++)
+			if (!simulate(path, atoi(argv[optind]))) ok = false;
+	}
+	else
+	{
+		for (unsigned u = 0; u < count_of(default_clocks); u++)
+			if (!simulate(path, default_clocks[u])) ok = false;
+	}
+	free(expects);
+	free(events);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,997 @@
+
+#define	_GNU_SOURCE		// For strcasestr()
+
+#include "pio_sim.h"
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+// Instruction classes, in bits 13..15
+#define	OP_JMP		0
+#define	OP_WAIT		1
+#define	OP_IN		2
+#define	OP_OUT		3
+#define	OP_PUSH_PULL	4
+#define	OP_MOV		5
+#define	OP_IRQ		6
+#define	OP_SET		7
+
+// Sources and destinations, in the order they are encoded
+static const char * const jmp_conds[8] = {
+	"", "!x", "x--", "!y", "y--", "x!=y", "pin", "!osre"
+};
+static const char * const wait_srcs[8] = { "gpio", "pin", "irq" };
+static const char * const in_srcs[8] = {
+	"pins", "x", "y", "null", NULL, NULL, "isr", "osr"
+};
+static const char * const out_dests[8] = {
+	"pins", "x", "y", "null", "pindirs", "pc", "isr", "exec"
+};
+static const char * const mov_dests[8] = {
+	"pins", "x", "y", NULL, "exec", "pc", "isr", "osr"
+};
+static const char * const mov_srcs[8] = {
+	"pins", "x", "y", "null", NULL, "status", "isr", "osr"
+};
+static const char * const set_dests[8] = {
+	"pins", "x", "y", NULL, "pindirs", NULL, NULL, NULL
+};
+
+
+// ---------------------------------------------------------------------------
+// Assembler
+
+#define	MAX_DEFINES		64
+
+typedef struct
+{
+	const char *path;
+	unsigned line_no;
+	char *err;
+	unsigned err_len;
+	bool failed;
+
+	struct
+	{
+		char name[32];
+		long value;
+	} defines[MAX_DEFINES];
+	unsigned n_defines;
+	int sysclk_mhz;
+
+	pio_sim_program_t *prog;
+	bool resolve;			// Second pass, when the labels are known
+} assembler_t;
+
+static void asm_error(assembler_t *as, const char *fmt, ...)
+{
+	va_list ap;
+	unsigned n;
+
+	if (as->failed) return;
+	as->failed = true;
+	n = snprintf(as->err, as->err_len, "%s:%u: ", as->path, as->line_no);
+	if (n >= as->err_len) return;
+	va_start(ap, fmt);
+	vsnprintf(as->err + n, as->err_len - n, fmt, ap);
+	va_end(ap);
+}
+
+static void define(assembler_t *as, const char *name, long value)
+{
+	// SYSCLK_MHZ can be overridden, to try the programs at other speeds
+	if ((as->sysclk_mhz > 0) && (strcmp(name, "SYSCLK_MHZ") == 0))
+		value = as->sysclk_mhz;
+	for (unsigned u = 0; u < as->n_defines; u++)
+	{
+		if (strcmp(as->defines[u].name, name) == 0)
+		{
+			as->defines[u].value = value;
+			return;
+		}
+	}
+	if (as->n_defines >= MAX_DEFINES)
+	{
+		asm_error(as, "too many defines");
+		return;
+	}
+	snprintf(as->defines[as->n_defines].name,
+		sizeof(as->defines[0].name), "%s", name);
+	as->defines[as->n_defines++].value = value;
+}
+
+static bool lookup(assembler_t *as, const char *name, long *value)
+{
+	for (unsigned u = 0; u < as->n_defines; u++)
+	{
+		if (strcmp(as->defines[u].name, name) == 0)
+		{
+			*value = as->defines[u].value;
+			return true;
+		}
+	}
+	for (unsigned u = 0; u < as->prog->n_labels; u++)
+	{
+		if (strcmp(as->prog->labels[u].name, name) == 0)
+		{
+			*value = as->prog->labels[u].offset;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Expressions: integers, defines and labels, + - * / and brackets
+static long expr_sum(assembler_t *as, const char **pp);
+
+static void skip_space(const char **pp)
+{
+	while (isspace((unsigned char)**pp)) (*pp)++;
+}
+
+static long expr_atom(assembler_t *as, const char **pp)
+{
+	const char *p;
+	long value = 0;
+
+	skip_space(pp);
+	p = *pp;
+	if (*p == '(')
+	{
+		*pp = p + 1;
+		value = expr_sum(as, pp);
+		skip_space(pp);
+		if (**pp != ')') asm_error(as, "missing )");
+		else (*pp)++;
+	}
+	else if (*p == '-')
+	{
+		*pp = p + 1;
+		value = -expr_atom(as, pp);
+	}
+	else if (isdigit((unsigned char)*p))
+	{
+		char *end;
+
+		if ((p[0] == '0') && ((p[1] == 'b') || (p[1] == 'B')))
+			value = strtol(p + 2, &end, 2);
+		else value = strtol(p, &end, 0);
+		*pp = end;
+	}
+	else if (isalpha((unsigned char)*p) || (*p == '_'))
+	{
+		char name[32];
+		unsigned n = 0;
+
+		while ((isalnum((unsigned char)*p) || (*p == '_'))
+			&& (n < sizeof(name) - 1))
+			name[n++] = *p++;
+		name[n] = '\0';
+		*pp = p;
+		// Labels aren't all known on the first pass
+		if (!lookup(as, name, &value) && as->resolve)
+			asm_error(as, "unknown symbol %s", name);
+	}
+	else asm_error(as, "bad expression at '%s'", p);
+	return value;
+}
+
+static long expr_product(assembler_t *as, const char **pp)
+{
+	long value = expr_atom(as, pp);
+
+	for (;;)
+	{
+		skip_space(pp);
+		if (**pp == '*')
+		{
+			(*pp)++;
+			value *= expr_atom(as, pp);
+		}
+		else if (**pp == '/')
+		{
+			long div;
+
+			(*pp)++;
+			div = expr_atom(as, pp);
+			if (div == 0) asm_error(as, "division by zero");
+			else value /= div;
+		}
+		else return value;
+	}
+}
+
+static long expr_sum(assembler_t *as, const char **pp)
+{
+	long value = expr_product(as, pp);
+
+	for (;;)
+	{
+		skip_space(pp);
+		if (**pp == '+')
+		{
+			(*pp)++;
+			value += expr_product(as, pp);
+		}
+		else if (**pp == '-')
+		{
+			(*pp)++;
+			value -= expr_product(as, pp);
+		}
+		else return value;
+	}
+}
+
+static long expr(assembler_t *as, const char *s)
+{
+	long value = expr_sum(as, &s);
+
+	skip_space(&s);
+	if (*s != '\0') asm_error(as, "junk after expression: '%s'", s);
+	return value;
+}
+
+// Index of a keyword in a table, or -1
+static int keyword(const char *word, const char * const *table, unsigned n)
+{
+	for (unsigned u = 0; u < n; u++)
+		if ((table[u] != NULL) && (strcasecmp(word, table[u]) == 0))
+			return u;
+	return -1;
+}
+
+static int operand(assembler_t *as, const char *word,
+	const char * const *table, const char *what)
+{
+	int i = (word != NULL) ? keyword(word, table, 8) : -1;
+
+	if (i < 0) asm_error(as, "bad %s '%s'", what, word ? word : "");
+	return (i < 0) ? 0 : i;
+}
+
+// Bit count operand, where 32 is encoded as 0
+static unsigned bit_count(assembler_t *as, const char *s)
+{
+	long n = (s != NULL) ? expr(as, s) : 0;
+
+	if ((n < 1) || (n > 32)) asm_error(as, "bad bit count");
+	return n & 0x1f;
+}
+
+// Assemble one instruction.  words[] is the instruction with the delay
+// and side-set already removed, split on spaces and commas.
+static uint16_t encode(assembler_t *as, char **words, unsigned n)
+{
+	const char *op = words[0];
+	uint16_t instr = 0;
+
+	if (strcasecmp(op, "nop") == 0)
+	{
+		// mov y, y
+		return (OP_MOV << 13) | (2 << 5) | 2;
+	}
+	if (strcasecmp(op, "jmp") == 0)
+	{
+		int cond = 0;
+		long addr;
+
+		if (n > 2) cond = operand(as, words[1], jmp_conds, "condition");
+		addr = (n > 1) ? expr(as, words[n - 1]) : 0;
+		if ((addr < 0) || (addr >= PIO_SIM_MAX_CODE))
+			asm_error(as, "bad jump target");
+		return (OP_JMP << 13) | (cond << 5) | (addr & 0x1f);
+	}
+	if (strcasecmp(op, "wait") == 0)
+	{
+		long pol, index;
+		int src;
+
+		if (n < 4)
+		{
+			asm_error(as, "wait needs polarity, source and index");
+			return 0;
+		}
+		pol = expr(as, words[1]);
+		src = operand(as, words[2], wait_srcs, "wait source");
+		index = expr(as, words[3]);
+		if ((n > 4) && (strcasecmp(words[4], "rel") == 0)) index |= 0x10;
+		return (OP_WAIT << 13) | ((pol & 1) << 7) | (src << 5)
+			| (index & 0x1f);
+	}
+	if (strcasecmp(op, "in") == 0)
+	{
+		return (OP_IN << 13)
+			| (operand(as, (n > 1) ? words[1] : NULL, in_srcs,
+				"in source") << 5)
+			| bit_count(as, (n > 2) ? words[2] : NULL);
+	}
+	if (strcasecmp(op, "out") == 0)
+	{
+		return (OP_OUT << 13)
+			| (operand(as, (n > 1) ? words[1] : NULL, out_dests,
+				"out destination") << 5)
+			| bit_count(as, (n > 2) ? words[2] : NULL);
+	}
+	if ((strcasecmp(op, "push") == 0) || (strcasecmp(op, "pull") == 0))
+	{
+		bool pull = (strcasecmp(op, "pull") == 0);
+		bool block = true, if_cond = false;
+
+		for (unsigned u = 1; u < n; u++)
+		{
+			if (strcasecmp(words[u], "block") == 0) block = true;
+			else if (strcasecmp(words[u], "noblock") == 0) block = false;
+			else if (strcasecmp(words[u], pull ? "ifempty" : "iffull") == 0)
+				if_cond = true;
+			else asm_error(as, "bad %s option '%s'", op, words[u]);
+		}
+		return (OP_PUSH_PULL << 13) | (pull << 7) | (if_cond << 6)
+			| (block << 5);
+	}
+	if (strcasecmp(op, "mov") == 0)
+	{
+		const char *src = (n > 2) ? words[2] : "";
+		unsigned mov_op = 0;
+		int dest;
+
+		dest = operand(as, (n > 1) ? words[1] : NULL, mov_dests,
+			"mov destination");
+		if ((*src == '~') || (*src == '!'))
+		{
+			mov_op = 1;
+			src++;
+		}
+		else if (strncmp(src, "::", 2) == 0)
+		{
+			mov_op = 2;
+			src += 2;
+		}
+		return (OP_MOV << 13) | (dest << 5) | (mov_op << 3)
+			| operand(as, src, mov_srcs, "mov source");
+	}
+	if (strcasecmp(op, "irq") == 0)
+	{
+		unsigned clr = 0, wait = 0, u = 1;
+		long index;
+
+		if ((u < n) && (strcasecmp(words[u], "set") == 0)) u++;
+		else if ((u < n) && (strcasecmp(words[u], "nowait") == 0)) u++;
+		else if ((u < n) && (strcasecmp(words[u], "wait") == 0))
+		{
+			wait = 1;
+			u++;
+		}
+		else if ((u < n) && (strcasecmp(words[u], "clear") == 0))
+		{
+			clr = 1;
+			u++;
+		}
+		index = (u < n) ? expr(as, words[u++]) : 0;
+		if ((u < n) && (strcasecmp(words[u], "rel") == 0)) index |= 0x10;
+		return (OP_IRQ << 13) | (clr << 6) | (wait << 5) | (index & 0x1f);
+	}
+	if (strcasecmp(op, "set") == 0)
+	{
+		long data = (n > 2) ? expr(as, words[2]) : 0;
+
+		if ((data < 0) || (data > 31)) asm_error(as, "bad set value");
+		return (OP_SET << 13)
+			| (operand(as, (n > 1) ? words[1] : NULL, set_dests,
+				"set destination") << 5)
+			| (data & 0x1f);
+	}
+	asm_error(as, "unknown instruction '%s'", op);
+	return instr;
+}
+
+// Assemble an instruction line, including any side-set and delay
+static void instruction(assembler_t *as, char *line)
+{
+	pio_sim_program_t *prog = as->prog;
+	char *words[8], *p, *bracket;
+	unsigned n = 0, delay_bits;
+	long delay = 0, side = -1;
+	uint16_t instr;
+
+	if (prog->length >= PIO_SIM_MAX_CODE)
+	{
+		asm_error(as, "program too long");
+		return;
+	}
+
+	// Delay is a bracketed expression at the end
+	if ((bracket = strchr(line, '[')) != NULL)
+	{
+		char *close = strrchr(bracket, ']');
+
+		if (close == NULL)
+		{
+			asm_error(as, "missing ]");
+			return;
+		}
+		*close = '\0';
+		delay = expr(as, bracket + 1);
+		*bracket = '\0';
+	}
+
+	// Side-set follows the operands
+	for (p = line; (p = strcasestr(p, "side")) != NULL; p += 4)
+	{
+		if (((p == line) || isspace((unsigned char)p[-1]))
+			&& isspace((unsigned char)p[4]))
+		{
+			side = expr(as, p + 5);
+			*p = '\0';
+			break;
+		}
+	}
+
+	for (p = strtok(line, " \t,"); (p != NULL) && (n < 8);
+		p = strtok(NULL, " \t,"))
+		words[n++] = p;
+	if (n == 0) return;
+	instr = encode(as, words, n);
+
+	delay_bits = 5 - prog->sideset_bits;
+	if ((delay < 0) || (delay >= (1 << delay_bits)))
+		asm_error(as, "delay %ld too big", delay);
+	instr |= (delay & ((1 << delay_bits) - 1)) << 8;
+	if (side >= 0)
+	{
+		unsigned value_bits = prog->sideset_bits - prog->sideset_opt;
+
+		if ((prog->sideset_bits == 0) || (side >= (1 << value_bits)))
+			asm_error(as, "bad side-set");
+		if (prog->sideset_opt) side |= 1 << value_bits;
+		instr |= side << (8 + delay_bits);
+	}
+	else if ((prog->sideset_bits != 0) && !prog->sideset_opt)
+		asm_error(as, "side-set required");
+	prog->code[prog->length++] = instr;
+}
+
+static void add_label(assembler_t *as, const char *name)
+{
+	pio_sim_program_t *prog = as->prog;
+
+	if (as->resolve) return;
+	if (prog->n_labels >= PIO_SIM_MAX_LABELS)
+	{
+		asm_error(as, "too many labels");
+		return;
+	}
+	snprintf(prog->labels[prog->n_labels].name,
+		sizeof(prog->labels[0].name), "%s", name);
+	prog->labels[prog->n_labels++].offset = prog->length;
+}
+
+// One pass over the file, assembling the named program
+static void assemble_pass(assembler_t *as, FILE *f, const char *program)
+{
+	char buf[256];
+	bool in_program = false, in_block = false, found = false;
+	bool any_program = false;
+
+	as->line_no = 0;
+	as->n_defines = 0;
+	as->prog->length = 0;
+	while (!as->failed && (fgets(buf, sizeof(buf), f) != NULL))
+	{
+		char *line = buf, *p, *colon;
+
+		as->line_no++;
+
+		// Pass-through code blocks
+		if (in_block)
+		{
+			if (strncmp(line, "%}", 2) == 0) in_block = false;
+			continue;
+		}
+		if (line[0] == '%')
+		{
+			in_block = true;
+			continue;
+		}
+
+		// Comments
+		if ((p = strchr(line, ';')) != NULL) *p = '\0';
+		if ((p = strstr(line, "//")) != NULL) *p = '\0';
+		while (isspace((unsigned char)*line)) line++;
+		p = line + strlen(line);
+		while ((p > line) && isspace((unsigned char)p[-1])) *--p = '\0';
+		if (*line == '\0') continue;
+
+		if (line[0] == '.')
+		{
+			char *directive = strtok(line, " \t");
+			char *arg = strtok(NULL, " \t");
+
+			if (strcasecmp(directive, ".program") == 0)
+			{
+				any_program = true;
+				in_program = (arg != NULL) && (strcmp(arg, program) == 0);
+				if (in_program)
+				{
+					found = true;
+					snprintf(as->prog->name, sizeof(as->prog->name), "%s",
+						program);
+				}
+			}
+			else if (strcasecmp(directive, ".define") == 0)
+			{
+				if ((arg != NULL) && (strcasecmp(arg, "public") == 0))
+					arg = strtok(NULL, " \t");
+				p = strtok(NULL, "");
+				if ((arg == NULL) || (p == NULL))
+					asm_error(as, "bad .define");
+				// Defines in programs are local to them
+				else if (in_program || !any_program)
+					define(as, arg, expr(as, p));
+			}
+			else if (!in_program) continue;
+			else if (strcasecmp(directive, ".side_set") == 0)
+			{
+				as->prog->sideset_bits = arg ? atoi(arg) : 0;
+				as->prog->sideset_opt = false;
+				while ((p = strtok(NULL, " \t")) != NULL)
+					if (strcasecmp(p, "opt") == 0)
+						as->prog->sideset_opt = true;
+				as->prog->sideset_bits += as->prog->sideset_opt;
+				if (as->prog->sideset_bits > 5)
+					asm_error(as, "too many side-set bits");
+			}
+			else if (strcasecmp(directive, ".wrap_target") == 0)
+				as->prog->wrap_target = as->prog->length;
+			else if (strcasecmp(directive, ".wrap") == 0)
+				as->prog->wrap = as->prog->length - 1;
+			// Others (.origin, .lang_opt etc.) don't affect the code
+			continue;
+		}
+		if (!in_program) continue;
+
+		// Labels, optionally public
+		if ((colon = strchr(line, ':')) != NULL && (colon[1] != ':'))
+		{
+			*colon = '\0';
+			if (strncasecmp(line, "public", 6) == 0
+				&& isspace((unsigned char)line[6]))
+				line += 7;
+			while (isspace((unsigned char)*line)) line++;
+			add_label(as, line);
+			line = colon + 1;
+			while (isspace((unsigned char)*line)) line++;
+			if (*line == '\0') continue;
+		}
+		instruction(as, line);
+	}
+	if (!found && !as->failed)
+	{
+		as->line_no = 0;
+		asm_error(as, "no program '%s'", program);
+	}
+}
+
+// Assemble one program from a .pio file.  If sysclk_mhz is non-zero it
+// overrides SYSCLK_MHZ.  Returns false with a message in err on failure.
+bool pio_sim_assemble(const char *path, const char *program,
+	int sysclk_mhz, pio_sim_program_t *prog, char *err, unsigned err_len)
+{
+	assembler_t as = {
+		.path = path, .err = err, .err_len = err_len,
+		.sysclk_mhz = sysclk_mhz, .prog = prog
+	};
+	FILE *f;
+
+	memset(prog, 0, sizeof(*prog));
+	prog->wrap = PIO_SIM_MAX_CODE;
+	f = fopen(path, "r");
+	if (f == NULL)
+	{
+		snprintf(err, err_len, "%s: can't open", path);
+		return false;
+	}
+
+	// First pass finds the labels, second resolves them
+	assemble_pass(&as, f, program);
+	as.resolve = true;
+	rewind(f);
+	if (!as.failed) assemble_pass(&as, f, program);
+	fclose(f);
+
+	if (prog->wrap >= prog->length) prog->wrap = prog->length - 1;
+	return !as.failed;
+}
+
+// Offset of a label in the program, or -1
+int pio_sim_find_label(const pio_sim_program_t *prog, const char *label)
+{
+	for (unsigned u = 0; u < prog->n_labels; u++)
+		if (strcmp(prog->labels[u].name, label) == 0)
+			return prog->labels[u].offset;
+	return -1;
+}
+
+
+// ---------------------------------------------------------------------------
+// Interpreter
+
+// Set up a state machine with the SDK's default configuration, to start
+// at the given offset.  The configuration can then be changed as the
+// program's init function would.
+void pio_sim_init(pio_sim_sm_t *sm, const pio_sim_program_t *prog,
+	unsigned start)
+{
+	memset(sm, 0, sizeof(*sm));
+	sm->prog = prog;
+	sm->out_shift_right = true;
+	sm->in_shift_right = true;
+	sm->pull_threshold = 32;
+	sm->push_threshold = 32;
+	sm->fifo_depth = 4;
+	sm->pc = start;
+}
+
+// Put a word in the TX FIFO.  Returns false if full.
+bool pio_sim_put(pio_sim_sm_t *sm, uint32_t word)
+{
+	if (sm->tx_level >= sm->fifo_depth) return false;
+	sm->txf[(sm->tx_head + sm->tx_level++) % sm->fifo_depth] = word;
+	return true;
+}
+
+// Get a word from the RX FIFO.  Returns false if empty.
+bool pio_sim_get(pio_sim_sm_t *sm, uint32_t *word)
+{
+	if (sm->rx_level == 0) return false;
+	*word = sm->rxf[sm->rx_head];
+	sm->rx_head = (sm->rx_head + 1) % sm->fifo_depth;
+	sm->rx_level--;
+	return true;
+}
+
+static bool pin(pio_sim_sm_t *sm, unsigned n)
+{
+	uint64_t cycle = (sm->cycle >= PIO_SIM_INPUT_DELAY)
+		? sm->cycle - PIO_SIM_INPUT_DELAY : 0;
+
+	return (sm->pin_in != NULL) && sm->pin_in(sm->ctx, cycle, n & 31);
+}
+
+static uint32_t in_pins(pio_sim_sm_t *sm)
+{
+	uint32_t value = 0;
+
+	for (unsigned u = 0; u < 32; u++)
+		if (pin(sm, sm->in_base + u)) value |= 1u << u;
+	return value;
+}
+
+static void out_pins(pio_sim_sm_t *sm, uint32_t value)
+{
+	uint32_t mask = (sm->out_count >= 32) ? ~0u : (1u << sm->out_count) - 1;
+
+	if (sm->pins_out != NULL) sm->pins_out(sm->ctx, sm->cycle, value & mask);
+}
+
+static bool pull(pio_sim_sm_t *sm)
+{
+	if (sm->tx_level == 0) return false;
+	sm->osr = sm->txf[sm->tx_head];
+	sm->tx_head = (sm->tx_head + 1) % sm->fifo_depth;
+	sm->tx_level--;
+	sm->osr_count = 0;
+	return true;
+}
+
+static bool push(pio_sim_sm_t *sm)
+{
+	if (sm->rx_level >= sm->fifo_depth) return false;
+	sm->rxf[(sm->rx_head + sm->rx_level++) % sm->fifo_depth] = sm->isr;
+	sm->isr = 0;
+	sm->isr_count = 0;
+	return true;
+}
+
+static void shift_in(pio_sim_sm_t *sm, uint32_t data, unsigned n)
+{
+	uint32_t mask = (n >= 32) ? ~0u : (1u << n) - 1;
+
+	data &= mask;
+	if (n >= 32) sm->isr = data;
+	else if (sm->in_shift_right)
+		sm->isr = (sm->isr >> n) | (data << (32 - n));
+	else sm->isr = (sm->isr << n) | data;
+	sm->isr_count = (sm->isr_count + n > 32) ? 32 : sm->isr_count + n;
+}
+
+static uint32_t shift_out(pio_sim_sm_t *sm, unsigned n)
+{
+	uint32_t data;
+
+	if (n >= 32)
+	{
+		data = sm->osr;
+		sm->osr = 0;
+	}
+	else if (sm->out_shift_right)
+	{
+		data = sm->osr & ((1u << n) - 1);
+		sm->osr >>= n;
+	}
+	else
+	{
+		data = sm->osr >> (32 - n);
+		sm->osr <<= n;
+	}
+	sm->osr_count = (sm->osr_count + n > 32) ? 32 : sm->osr_count + n;
+	return data;
+}
+
+static uint32_t bit_reverse(uint32_t v)
+{
+	uint32_t r = 0;
+
+	for (unsigned u = 0; u < 32; u++)
+		if (v & (1u << u)) r |= 1u << (31 - u);
+	return r;
+}
+
+// Run the state machine for one clock cycle
+void pio_sim_step(pio_sim_sm_t *sm)
+{
+	const pio_sim_program_t *prog = sm->prog;
+	uint16_t instr;
+	unsigned delay_bits, next, n, index;
+	bool stall = false;
+	uint32_t data;
+
+	if (sm->delay != 0)
+	{
+		sm->delay--;
+		sm->cycle++;
+		return;
+	}
+
+	instr = prog->code[sm->pc];
+	next = (sm->pc == prog->wrap) ? prog->wrap_target : sm->pc + 1;
+	n = instr & 0x1f;
+	if (n == 0) n = 32;
+	index = instr & 0x1f;
+
+	// Side-set happens at the start of the instruction, whether or not it
+	// then stalls.  The enable bit, if opt, is the top bit of the field.
+	if ((prog->sideset_bits != 0) && (sm->sideset_out != NULL))
+	{
+		unsigned field = ((instr >> 8) & 0x1f) >> (5 - prog->sideset_bits);
+		unsigned bits = prog->sideset_bits - prog->sideset_opt;
+
+		if (!prog->sideset_opt || (field >> bits))
+			sm->sideset_out(sm->ctx, sm->cycle, field & ((1 << bits) - 1));
+	}
+
+	switch (instr >> 13)
+	{
+		case OP_JMP:
+		{
+			bool take = false;
+
+			switch ((instr >> 5) & 7)
+			{
+				case 0:	take = true;						break;
+				case 1:	take = (sm->x == 0);				break;
+				case 2:	take = (sm->x-- != 0);				break;
+				case 3:	take = (sm->y == 0);				break;
+				case 4:	take = (sm->y-- != 0);				break;
+				case 5:	take = (sm->x != sm->y);			break;
+				case 6:	take = pin(sm, sm->jmp_pin);		break;
+				case 7:	take = (sm->osr_count < sm->pull_threshold);	break;
+			}
+			if (take)
+			{
+				next = instr & 0x1f;
+			}
+			break;
+		}
+
+		case OP_WAIT:
+		{
+			bool pol = (instr >> 7) & 1;
+
+			switch ((instr >> 5) & 3)
+			{
+				case 0:	stall = (pin(sm, index) != pol);				break;
+				case 1:	stall = (pin(sm, sm->in_base + index) != pol);	break;
+				case 2:
+					stall = (sm->irq[index & 7] != pol);
+					if (!stall && pol) sm->irq[index & 7] = false;
+					break;
+			}
+			break;
+		}
+
+		case OP_IN:
+			switch ((instr >> 5) & 7)
+			{
+				case 0:	data = in_pins(sm);	break;
+				case 1:	data = sm->x;		break;
+				case 2:	data = sm->y;		break;
+				case 6:	data = sm->isr;		break;
+				case 7:	data = sm->osr;		break;
+				default: data = 0;			break;
+			}
+			// Stalls without shifting if this would fill the ISR and
+			// there's no room to push it
+			if (sm->autopush && (sm->isr_count + n >= sm->push_threshold)
+				&& (sm->rx_level >= sm->fifo_depth))
+			{
+				stall = true;
+				sm->rxstalls++;
+				break;
+			}
+			shift_in(sm, data, n);
+			if (sm->autopush && (sm->isr_count >= sm->push_threshold))
+				push(sm);
+			break;
+
+		case OP_OUT:
+			if (sm->autopull && (sm->osr_count >= sm->pull_threshold)
+				&& !pull(sm))
+			{
+				stall = true;
+				sm->txstalls++;
+				break;
+			}
+			data = shift_out(sm, n);
+			switch ((instr >> 5) & 7)
+			{
+				case 0:	out_pins(sm, data);		break;
+				case 1:	sm->x = data;			break;
+				case 2:	sm->y = data;			break;
+				case 5:
+					next = data & 0x1f;
+					break;
+				case 6:
+					sm->isr = data;
+					sm->isr_count = n;
+					break;
+			}
+			break;
+
+		case OP_PUSH_PULL:
+		{
+			bool if_cond = (instr >> 6) & 1, block = (instr >> 5) & 1;
+
+			if (instr & 0x80)
+			{
+				// Pull: ifempty does nothing unless the threshold's reached
+				if (if_cond && (sm->osr_count < sm->pull_threshold)) break;
+				if (!pull(sm))
+				{
+					if (block)
+					{
+						stall = true;
+						sm->txstalls++;
+					}
+					else sm->osr = sm->x;
+				}
+			}
+			else
+			{
+				if (if_cond && (sm->isr_count < sm->push_threshold)) break;
+				if (!push(sm) && block)
+				{
+					stall = true;
+					sm->rxstalls++;
+				}
+			}
+			break;
+		}
+
+		case OP_MOV:
+			switch (instr & 7)
+			{
+				case 0:	data = in_pins(sm);	break;
+				case 1:	data = sm->x;		break;
+				case 2:	data = sm->y;		break;
+				case 5:
+					data = (sm->tx_level < 1) ? ~0u : 0;
+					break;
+				case 6:	data = sm->isr;		break;
+				case 7:	data = sm->osr;		break;
+				default: data = 0;			break;
+			}
+			if (((instr >> 3) & 3) == 1) data = ~data;
+			else if (((instr >> 3) & 3) == 2) data = bit_reverse(data);
+			switch ((instr >> 5) & 7)
+			{
+				case 0:	out_pins(sm, data);	break;
+				case 1:	sm->x = data;		break;
+				case 2:	sm->y = data;		break;
+				case 5:
+					next = data & 0x1f;
+					break;
+				case 6:
+					sm->isr = data;
+					sm->isr_count = 0;
+					break;
+				case 7:
+					sm->osr = data;
+					sm->osr_count = 0;
+					break;
+			}
+			break;
+
+		case OP_IRQ:
+			// Only the one state machine, so rel makes no difference
+			if (instr & 0x40) sm->irq[index & 7] = false;
+			else sm->irq[index & 7] = true;
+			break;
+
+		case OP_SET:
+			switch ((instr >> 5) & 7)
+			{
+				case 1:	sm->x = index;	break;
+				case 2:	sm->y = index;	break;
+			}
+			break;
+	}
+
+	sm->cycle++;
+	if (stall) return;
+
+	delay_bits = 5 - prog->sideset_bits;
+	sm->delay = (instr >> 8) & ((1 << delay_bits) - 1);
+	sm->pc = next;
+}
+
+// Disassemble one instruction (without side-set or delay)
+void pio_sim_disassemble(uint16_t instr, char *buf, unsigned len)
+{
+	unsigned n = instr & 0x1f;
+
+	switch (instr >> 13)
+	{
+		case OP_JMP:
+			snprintf(buf, len, "jmp %s%s%u", jmp_conds[(instr >> 5) & 7],
+				((instr >> 5) & 7) ? " " : "", n);
+			break;
+		case OP_WAIT:
+			snprintf(buf, len, "wait %u %s %u", (instr >> 7) & 1,
+				wait_srcs[(instr >> 5) & 3] ? wait_srcs[(instr >> 5) & 3]
+				: "?", n);
+			break;
+		case OP_IN:
+			snprintf(buf, len, "in %s, %u", in_srcs[(instr >> 5) & 7]
+				? in_srcs[(instr >> 5) & 7] : "?", n ? n : 32);
+			break;
+		case OP_OUT:
+			snprintf(buf, len, "out %s, %u", out_dests[(instr >> 5) & 7],
+				n ? n : 32);
+			break;
+		case OP_PUSH_PULL:
+			snprintf(buf, len, "%s%s %s", (instr & 0x80) ? "pull" : "push",
+				(instr & 0x40) ? ((instr & 0x80) ? " ifempty" : " iffull")
+				: "", (instr & 0x20) ? "block" : "noblock");
+			break;
+		case OP_MOV:
+			snprintf(buf, len, "mov %s, %s%s", mov_dests[(instr >> 5) & 7]
+				? mov_dests[(instr >> 5) & 7] : "?",
+				(((instr >> 3) & 3) == 1) ? "~"
+				: (((instr >> 3) & 3) == 2) ? "::" : "",
+				mov_srcs[instr & 7] ? mov_srcs[instr & 7] : "?");
+			break;
+		case OP_IRQ:
+			snprintf(buf, len, "irq %s%u%s", (instr & 0x40) ? "clear "
+				: (instr & 0x20) ? "wait " : "", n & 7,
+				(n & 0x10) ? " rel" : "");
+			break;
+		case OP_SET:
+			snprintf(buf, len, "set %s, %u", set_dests[(instr >> 5) & 7]
+				? set_dests[(instr >> 5) & 7] : "?", n);
+			break;
+	}
+}
@@ -0,0 +1,90 @@
+// Assembler and cycle-by-cycle interpreter for RP2040 PIO programs, for
+// checking the timing of mode7.pio on a PC.  The assembler handles the
+// subset of pioasm syntax used in mode7.pio and produces the same
+// machine code; the interpreter runs one state machine against callbacks
+// for the input pins, and records the output pins.
+
+#ifndef PIO_SIM_H
+#define PIO_SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define	PIO_SIM_MAX_CODE	32
+#define	PIO_SIM_MAX_LABELS	16
+
+// An assembled program
+typedef struct
+{
+	char name[32];
+	uint16_t code[PIO_SIM_MAX_CODE];
+	unsigned length;
+	unsigned wrap_target, wrap;		// Default to the whole program
+	unsigned sideset_bits;			// Including the enable bit if opt
+	bool sideset_opt;
+	struct
+	{
+		char name[32];
+		unsigned offset;
+	} labels[PIO_SIM_MAX_LABELS];
+	unsigned n_labels;
+} pio_sim_program_t;
+
+// Value of an input pin at a given cycle
+typedef bool (*pio_sim_pin_fn)(void *ctx, uint64_t cycle, unsigned pin);
+
+// Called when an instruction writes the output pins (value is the new
+// state of the out_count pins from out_base), at the cycle it takes effect.
+// Also used for side-set, with the value of the side-set pins.
+typedef void (*pio_sim_out_fn)(void *ctx, uint64_t cycle, uint32_t value);
+
+// State machine configuration and state
+typedef struct
+{
+	// Configuration, as set by the c-sdk init functions
+	const pio_sim_program_t *prog;
+	unsigned in_base, out_base, out_count, jmp_pin;
+	bool out_shift_right, autopull;
+	unsigned pull_threshold;			// 1..32
+	bool in_shift_right, autopush;
+	unsigned push_threshold;
+	unsigned fifo_depth;				// 4, or 8 if joined
+
+	// Callbacks
+	pio_sim_pin_fn pin_in;
+	pio_sim_out_fn pins_out;
+	pio_sim_out_fn sideset_out;			// Called for every side-set
+	void *ctx;
+
+	// State
+	uint64_t cycle;
+	unsigned pc;
+	uint32_t x, y, osr, isr;
+	unsigned osr_count, isr_count;		// Bits shifted out of / into
+	unsigned delay;						// Delay cycles still to go
+	bool stalled;
+	uint32_t txf[8];
+	unsigned tx_level, tx_head;
+	uint32_t rxf[8];
+	unsigned rx_level, rx_head;
+	bool irq[8];
+	unsigned txstalls;					// Cycles stalled on an empty TX FIFO
+	unsigned rxstalls;					// Cycles stalled on a full RX FIFO
+} pio_sim_sm_t;
+
+// Input synchroniser delay, in cycles, between a pin changing and an
+// instruction seeing it
+#define	PIO_SIM_INPUT_DELAY		2
+
+extern bool pio_sim_assemble(const char *path, const char *program,
+	int sysclk_mhz, pio_sim_program_t *prog, char *err, unsigned err_len);
+extern int pio_sim_find_label(const pio_sim_program_t *prog,
+	const char *label);
+extern void pio_sim_init(pio_sim_sm_t *sm, const pio_sim_program_t *prog,
+	unsigned start);
+extern bool pio_sim_put(pio_sim_sm_t *sm, uint32_t word);
+extern bool pio_sim_get(pio_sim_sm_t *sm, uint32_t *word);
+extern void pio_sim_step(pio_sim_sm_t *sm);
+extern void pio_sim_disassemble(uint16_t instr, char *buf, unsigned len);
+
+#endif
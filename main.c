@@ -4,6 +4,11 @@
 // otherwise the sync pin is an input and the Electron assumed to generate them
 #define	GENERATE_SYNCS	1
 
+// Compile option to display the screen the Electron writes to &7C00-&7FFF,
+// captured from its bus, rather than the test pages.  Needs the Electron,
+// so the default is to only do it when it's providing the syncs too.
+#define	SNOOP_BUS		(!GENERATE_SYNCS)
+
 
 
 
@@ -11,6 +16,7 @@
 #include "pico/bootrom.h"
 #include "pico/multicore.h"
 #include "hardware/clocks.h"
+#include "hardware/regs/addressmap.h"
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -31,34 +37,40 @@
 // Rate of switching between the demo images
 #define	CAROUSEL_RATE	(5*50)
 
+#if SNOOP_BUS
+// Copy of the Electron's screen, kept up to date by the bus capture
+static const uint8_t *bus_page;
+#endif
 
 static void core1_main_loop(void)
 {
-	unsigned carousel_count = 0, flash_count = 0;
+	unsigned flash_count = 0;
 	bool flash_on = false;
-	unsigned page_no = 0;
+#if SNOOP_BUS
+	const uint8_t *current_page = bus_page;
+#else
+	unsigned carousel_count = 0, page_no = 0;
 	const uint8_t *current_page = test_pages[0];
+#endif
 
 
 #if GENERATE_SYNCS
-	// Launch the sync generator, which continues under IRQ.
-	// We can afford to do it from this core, as the IRQ fires aligned
-	// with HSYNC, which is just when the main code is idle waiting
-	// for the first pixel on the next line.
+	// Launch the sync generator, which continues from DMA.
 	syncgen_start();
 #endif
 
 	// Initialise the PIO etc.
-	mode7_init();
+	mode7_init(clock_get_hz(clk_sys));
 
 	for (;;)
 	{
-		mode7_display_field(current_page, flash_on);
+		mode7_display_field(&MODE7_PAGE(current_page), flash_on);
 		if (flash_count++ >= FLASH_RATE)
 		{
 			flash_on = !flash_on;
 			flash_count = 0;
 		}
+#if !SNOOP_BUS
 		if (carousel_count++ >= CAROUSEL_RATE)
 		{
 			carousel_count = 0;
@@ -66,9 +78,26 @@ static void core1_main_loop(void)
 			if (page_no >= NOOF_TEST_PAGES) page_no = 0;
 			current_page = test_pages[page_no];
 		}
+#endif
 	}
 }
 
+// Name of the memory an address is in
+static const char *memory_region(const void *p)
+{
+	uintptr_t addr = (uintptr_t)p;
+
+	if (addr >= XIP_BASE && addr < XIP_BASE + PICO_FLASH_SIZE_BYTES)
+		return "flash (XIP)";
+	if (addr >= SRAM_STRIPED_BASE && addr < SRAM_STRIPED_END)
+		return "SRAM0-3 (striped)";
+	if (addr >= SRAM4_BASE && addr < SRAM5_BASE)
+		return "SRAM4 (scratch X)";
+	if (addr >= SRAM5_BASE && addr < SRAM_END)
+		return "SRAM5 (scratch Y)";
+	return "?";
+}
+
 int pollchar(void)
 {
   int c = getchar_timeout_us(0);
@@ -83,8 +112,8 @@ int main(void)
 	bool launched = false;
 	bool clock_ok;
 
-	// The system clock speed is set as a constant in the PIO file
-	// NB. needs to be a multiple of 12MHz for Mode 7
+	// The system clock speed is set as a constant in the PIO file, but
+	// can be anything from 96MHz: mode7_init() adapts to it
 	clock_ok = set_sys_clock_khz(SYSCLK_MHZ * 1000, false);
 
 	// USB console for monitoring
@@ -100,17 +129,27 @@ int main(void)
 	gpio_put(PIN_RGB_EN, 0);
 
 	// Output enables for the 74lvc245 buffers
-	// We aren't using these, so just set the pullup to give a safe state.
+	// Until the bus capture uses these (if at all), just set the pullup
+	// to give a safe state.
 	gpio_pull_up(PIN_SELAL);
 	gpio_pull_up(PIN_SELAH);
 	gpio_pull_up(PIN_SELDT);
 
+#if SNOOP_BUS
+	// Start capturing the screen straight away, so that nothing the
+	// Electron writes before the display is launched gets missed.
+	// This takes the SEL pins over from the pullups.
+	bus_page = buscapture_start();
+#endif
+
 	// Discard any character that got in the UART during powerup
 	getchar_timeout_us(10);
 
 	for (;;)
 	{
-		int c = getchar_timeout_us(100);
+		int c;
+
+		c = getchar_timeout_us(100);
 		if (c >= 0)
 		{
 			if (!clock_ok) printf("Failed to set clock\n");
@@ -118,7 +157,9 @@ int main(void)
 				git_CommitDate(),
 				git_AnyUncommittedChanges() ? " ***modified***" : "");
 
-			printf("'L' to launch display, 'B' to revert to bootrom\n");
+			printf("'L' to launch display, 'B' to revert to bootrom, "
+				"'S' for render stats, 'T' for FIFO stats, "
+				"'G' for genlock stats, 'M' for memory placement\n");
 			if (c == 'L')
 			{
 				if (launched) printf("Already launched\n");
@@ -127,6 +168,9 @@ int main(void)
 					printf("Launching video output\n");
 					launched = true;
 					multicore_launch_core1(core1_main_loop);
+					// Does nothing unless the display is rendered on
+					// this core
+					mode7_render_start();
 				}
 			}
 			else if (c == 'B')
@@ -138,6 +182,79 @@ int main(void)
 				reset_usb_boot(1 << PICO_DEFAULT_LED_PIN, 0);
 
 			}
+			else if (c == 'S')
+			{
+				mode7_cache_stats_t stats;
+				uint32_t total;
+
+				mode7_get_cache_stats(&stats);
+				total = stats.total_hits + stats.total_misses;
+				printf("Fields: %u\n", stats.fields);
+				printf("Line cache: %u hits, %u misses last field, "
+					"%u%% hit rate overall\n", stats.hits, stats.misses,
+					total
+						? (unsigned)((stats.total_hits * 100ull) / total) : 0);
+				printf("Cycles last field: %u rendering, %u lookup, "
+					"%u saved\n", stats.render_cycles, stats.lookup_cycles,
+					stats.cycles_saved);
+				if (stats.misses != 0)
+					printf("Per line decode: %u cycles\n",
+						stats.decode_cycles / stats.misses);
+				if (stats.rows_rendered != 0)
+					printf("Per scanline: %u cycles\n",
+						stats.row_cycles / stats.rows_rendered);
+				printf("Render stalls: %u\n", stats.render_stalls);
+			}
+			else if (c == 'T')
+			{
+				mode7_fifo_stats_t stats;
+
+				// Scanlines are 2 rows apart, 10 per character line
+				mode7_get_fifo_stats(&stats);
+				printf("Fields: %u\n", stats.fields);
+				printf("FIFO slack last field: %u words min (scanline %u, "
+					"line %u), %u average\n", stats.min_slack,
+					stats.min_scanline, stats.min_scanline / 10,
+					stats.avg_slack);
+				printf("Worst slack: %u words (scanline %u, line %u)\n",
+					stats.worst_slack, stats.worst_scanline,
+					stats.worst_scanline / 10);
+				printf("Underruns: %u last field (first at scanline %u), "
+					"%u total in %u fields\n", stats.underruns,
+					stats.first_underrun, stats.total_underruns,
+					stats.underrun_fields);
+#if SNOOP_BUS
+				printf("Bus capture: %s\n", buscapture_overrun()
+					? "missed writes since last asked" : "no writes missed");
+#endif
+			}
+			else if (c == 'G')
+			{
+				mode7_genlock_stats_t stats;
+
+				mode7_get_genlock_stats(&stats);
+				printf("Fields: %u, %s (%u losses)\n", stats.fields,
+					stats.locked ? "locked" : "not locked",
+					stats.lock_losses);
+				printf("Line rate error: %d ppb over %u lines last field, "
+					"%d ppb filtered\n", stats.rate_error, stats.lines,
+					stats.rate_filtered);
+				printf("Phase error at end of line: %dns, worst %dns "
+					"while locked\n", stats.phase_error,
+					stats.worst_phase);
+				printf("Clock divider: %u + %u/256 (%u changes)\n",
+					stats.div_int, stats.div_frac, stats.div_changes);
+			}
+			else if (c == 'M')
+			{
+				const mode7_placement_t *list;
+				unsigned n = mode7_get_placement(&list);
+
+				for (unsigned u = 0; u < n; u++)
+					printf("%-14s %08x %5u bytes  %s\n", list[u].name,
+						(unsigned)(uintptr_t)list[u].addr, list[u].size,
+						memory_region(list[u].addr));
+			}
 			else if (c == 'C')
 			{
 				unsigned sum = 0;
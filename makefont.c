@@ -242,1601 +242,6 @@ static uint8_t font_std[96*29] = {
 };
 
 
-static uint8_t font_std_dh_upper[] = {/* space	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* exclam	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* quotedbl	*/
-0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* quoteleft	*/
-0x18, 0xc0, 0x03, 0x7e, 0xe0, 0x07, 0xe7, 0x70, 0x0e, 0xc3, 0x30, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xf0, 0x03, 0x3f, 0xf0,  0x03,
-/* dollar	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0xb7, 0x73, 0x3b, 0x33, 0x33, 0x33, 0x30, 0x03, 0x33, 0xb0, 0x03, 0x3b, 0xf8, 0xc1, 0x1f, 0xfe, 0xe0, 0x07, 0x37, 0x70, 0x03, 0x33,  0x00,
-/* percent	*/
-0x80, 0x01, 0x18, 0xc1, 0x13, 0x3c, 0x83, 0x31, 0x18, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0,  0x01,
-/* ampersand	*/
-0xc0, 0x00, 0x0c, 0xe0, 0x01, 0x1e, 0xf0, 0x03, 0x3f, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0xf0, 0x03, 0x3f, 0xe0, 0x01, 0x1e, 0xe0, 0x01, 0x1e, 0xf3, 0x33, 0x3f, 0x3b,  0x03,
-/* quoteright	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* parenleft	*/
-0x0c, 0xc0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xe0,  0x00,
-/* parenright	*/
-0xc0, 0x00, 0x0c, 0xe0, 0x00, 0x0e, 0x70, 0x00, 0x07, 0x38, 0x80, 0x03, 0x1c, 0xc0, 0x01, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x1c,  0x00,
-/* asterisk	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x33, 0x33, 0x33, 0xb7, 0x73, 0x3b, 0xfe, 0xe1, 0x1f, 0xfc, 0xc0, 0x0f, 0x78, 0x80, 0x07, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xfe,  0x01,
-/* plus	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xf0, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* comma	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* hyphen	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* period	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* slash	*/
-0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x30, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0,  0x01,
-/* zero	*/
-0x00, 0x00, 0x03, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xce, 0xe1, 0x1c, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87,  0x03,
-/* one	*/
-0x30, 0x00, 0x03, 0x70, 0x00, 0x07, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* two	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1c, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x30, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x01, 0x3c, 0x80, 0x07, 0xf0, 0x00, 0x0e, 0xc0,  0x01,
-/* three	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x03, 0x30, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x1c, 0xc0, 0x01, 0x3c, 0xc0, 0x03, 0x3e, 0xe0, 0x03, 0x07, 0x70, 0x00, 0x03,  0x00,
-/* four	*/
-0x0c, 0xc0, 0x00, 0x1c, 0xc0, 0x01, 0x3c, 0xc0, 0x03, 0x7c, 0xc0, 0x07, 0xec, 0xc0, 0x0e, 0xcc, 0xc1, 0x1c, 0x8c, 0xc3, 0x38, 0x0c, 0xc3, 0x30, 0xff, 0xf3, 0x3f, 0xff,  0x03,
-/* five	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xf0, 0xc3, 0x3f, 0xfe, 0xf3, 0x3f, 0x0f, 0x70, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03,  0x00,
-/* six	*/
-0x1c, 0xc0, 0x03, 0x78, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x01, 0x1c, 0x80, 0x03, 0x38, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03,  0x03,
-/* seven	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x03, 0x30, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0,  0x00,
-/* eight	*/
-0xfc, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xfe, 0xe1, 0x1f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03,  0x03,
-/* nine	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x83, 0x33, 0x38, 0xff, 0xf1, 0x1f, 0xff, 0xf0, 0x07, 0x03, 0x30, 0x00, 0x07,  0x00,
-/* colon	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* semicolon	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* less	*/
-0x0c, 0xc0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x01, 0x1c, 0x80, 0x03, 0x38, 0x80, 0x03, 0x38, 0xc0, 0x01, 0x1c, 0xe0,  0x00,
-/* equal	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* greater	*/
-0xc0, 0x00, 0x0c, 0xe0, 0x00, 0x0e, 0x70, 0x00, 0x07, 0x38, 0x80, 0x03, 0x1c, 0xc0, 0x01, 0x0e, 0xe0, 0x00, 0x07, 0x70, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x1c,  0x00,
-/* question	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x07, 0x73, 0x30, 0x0e, 0xe0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* at	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x1f, 0xf3, 0x31, 0x3f, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0xf3, 0x33, 0x1e,  0x03,
-/* A	*/
-0x30, 0x00, 0x03, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xce, 0xe1, 0x1c, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0xff,  0x03,
-/* B	*/
-0xfc, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03,  0x03,
-/* C	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* D	*/
-0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* E	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0xfc, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* F	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0xfc, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* G	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x0f, 0xf3, 0x30, 0x0f,  0x03,
-/* H	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* I	*/
-0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* J	*/
-0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03,  0x00,
-/* K	*/
-0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0x0e, 0xe3, 0x30, 0x1c, 0xc3, 0x31, 0x38, 0x83, 0x33, 0x70, 0x03, 0x37, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x70, 0x03, 0x37, 0x38,  0x03,
-/* L	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* M	*/
-0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xcf, 0xf3, 0x3c, 0xff, 0xf3, 0x3f, 0x7b, 0xb3, 0x37, 0x33, 0x33, 0x33, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* N	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x83, 0x33, 0x38, 0xc3, 0x33, 0x3c, 0xe3, 0x33, 0x3e, 0x73, 0x33, 0x37, 0x3b, 0xb3, 0x33, 0x1f, 0xf3, 0x31, 0x0f,  0x03,
-/* O	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* P	*/
-0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0xfc, 0x83, 0x3f, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* Q	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0x33, 0x33, 0x3b,  0x03,
-/* R	*/
-0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0xfc, 0xc3, 0x3f, 0x70, 0x03, 0x37, 0x38,  0x03,
-/* S	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x00, 0x03, 0x30, 0x80, 0x03, 0x3c, 0xf0, 0xc1, 0x1f, 0xfe, 0xe0, 0x03, 0x0f, 0x70, 0x00, 0x03,  0x00,
-/* T	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* U	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* V	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xfc,  0x00,
-/* W	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,  0x03,
-/* X	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xfc, 0xc0, 0x0f, 0x78, 0x80, 0x07, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xce,  0x01,
-/* Y	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xfc, 0xc0, 0x0f, 0x78, 0x80, 0x07, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* Z	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x03, 0x30, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0,  0x01,
-/* bracketleft	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x01, 0x1c, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xc0, 0x01, 0x1c, 0xe0,  0x00,
-/* backslash	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x3c, 0xc3, 0x33, 0x3e,  0x03,
-/* bracketright	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x38, 0x80, 0x03, 0x1c, 0xc0, 0x01, 0x0e, 0xe0, 0x00, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x0e, 0xe0, 0x00, 0x1c,  0x00,
-/* asciicircum	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0xb7, 0x73, 0x3b, 0x33, 0x33, 0x33, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* numbersign	*/
-0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xff, 0xf3, 0x3f, 0xff,  0x03,
-/* underscore	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* a	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc0, 0x0f, 0xfe, 0xe0, 0x0f, 0x07, 0x70, 0x00, 0x03, 0x30, 0x00, 0xff, 0xf0, 0x0f, 0xff,  0x01,
-/* b	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* c	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x0f, 0xff, 0xf1, 0x1f, 0x80, 0x03, 0x38, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* d	*/
-0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0xff, 0xf0, 0x0f, 0xff, 0xf1, 0x1f, 0x83, 0x33, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* e	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0xff,  0x03,
-/* f	*/
-0x04, 0xc0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* g	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x0f, 0xff, 0xf1, 0x1f, 0x83, 0x33, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* h	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* i	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* j	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* k	*/
-0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc3, 0x30, 0x0c, 0xc7, 0x70, 0x0c, 0xce, 0xe0, 0x0c, 0xdc, 0xc0, 0x0d, 0xf8, 0x80, 0x0f, 0xf8,  0x00,
-/* l	*/
-0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* m	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3c, 0xfe, 0xe3, 0x3f, 0x7f, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,  0x03,
-/* n	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* o	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* p	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* q	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x0f, 0xff, 0xf1, 0x1f, 0x83, 0x33, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* r	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xf0, 0x0c, 0xdf, 0xc0, 0x0d, 0xf8, 0x80, 0x0f, 0xf0, 0x00, 0x0f, 0xc0, 0x00, 0x0c, 0xc0,  0x00,
-/* s	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x0f, 0xff, 0xf1, 0x1f, 0x80, 0x03, 0x38, 0x80, 0x03, 0x38, 0xfc, 0xc1, 0x1f, 0xfe,  0x00,
-/* t	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* u	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* v	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xcc,  0x00,
-/* w	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33,  0x03,
-/* x	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xfc, 0xc0, 0x0f, 0x78, 0x80, 0x07, 0x78,  0x00,
-/* y	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* z	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x0e, 0xe0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x70,  0x00,
-/* braceleft	*/
-0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc3, 0x30, 0x0c, 0xc7,  0x00,
-/* bar	*/
-0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc,  0x00,
-/* braceright	*/
-0x80, 0x03, 0x3c, 0xe0, 0x03, 0x3e, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 0xe3, 0x33, 0x3e, 0xc7,  0x03,
-/* divide	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* block	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-};
-
-
-static uint8_t font_std_dh_lower[] = {
-/* space	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* exclam	*/
-0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* quotedbl	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* quoteleft	*/
-0xf0, 0x03, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0xf0, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* dollar	*/
-0x33, 0x30, 0x33, 0x33, 0x73, 0x3b, 0xb7, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* percent	*/
-0xc0, 0x61, 0x38, 0x86, 0xf3, 0x30, 0x0f, 0xf3, 0x00, 0x0f, 0x60, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* ampersand	*/
-0x3b, 0xd3, 0x31, 0x1d, 0xe3, 0x38, 0x8e, 0x73, 0x1f, 0xf7, 0xb1, 0x0f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* quoteright	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* parenleft	*/
-0xe0, 0x00, 0x07, 0x70, 0x80, 0x03, 0x38, 0xc0, 0x01, 0x1c, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* parenright	*/
-0x1c, 0x80, 0x03, 0x38, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* asterisk	*/
-0xfe, 0x71, 0x3b, 0xb7, 0x33, 0x33, 0x33, 0x03, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* plus	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* comma	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* hyphen	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* period	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* slash	*/
-0xc0, 0x01, 0x38, 0x80, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* zero	*/
-0x87, 0xe3, 0x1c, 0xce, 0xc1, 0x0f, 0xfc, 0x80, 0x07, 0x78, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* one	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* two	*/
-0xc0, 0x01, 0x38, 0x80, 0x03, 0x30, 0x00, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* three	*/
-0x03, 0x30, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* four	*/
-0xff, 0xc3, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* five	*/
-0x03, 0x30, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* six	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* seven	*/
-0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* eight	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* nine	*/
-0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x01, 0x1c, 0x80, 0x03, 0xf8, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* colon	*/
-0x00, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* semicolon	*/
-0x00, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* less	*/
-0xe0, 0x00, 0x07, 0x70, 0x80, 0x03, 0x38, 0xc0, 0x01, 0x1c, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* equal	*/
-0x00, 0xf0, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* greater	*/
-0x1c, 0x80, 0x03, 0x38, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* question	*/
-0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* at	*/
-0x1e, 0x03, 0x30, 0x00, 0x03, 0x38, 0x80, 0xc3, 0x1f, 0xfc, 0xc1, 0x0f, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* A	*/
-0xff, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* B	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x30, 0x07, 0xe3, 0x3f, 0xfe, 0xc3, 0x3f, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* C	*/
-0x00, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* D	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x30, 0x07, 0xe3, 0x3f, 0xfe, 0xc3, 0x3f, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* E	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* F	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* G	*/
-0x0f, 0x33, 0x30, 0x03, 0x33, 0x38, 0x83, 0xf3, 0x1f, 0xff, 0xf1, 0x0f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* H	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* I	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* J	*/
-0x03, 0x30, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* K	*/
-0x38, 0xc3, 0x31, 0x1c, 0xe3, 0x30, 0x0e, 0x73, 0x30, 0x07, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* L	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* M	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* N	*/
-0x0f, 0x73, 0x30, 0x07, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* O	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* P	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Q	*/
-0x3b, 0xc3, 0x31, 0x1c, 0xe3, 0x38, 0x8e, 0x73, 0x1f, 0xf7, 0xb1, 0x0f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* R	*/
-0x38, 0xc3, 0x31, 0x1c, 0xe3, 0x30, 0x0e, 0x73, 0x30, 0x07, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* S	*/
-0x03, 0x30, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* T	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* U	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* V	*/
-0xfc, 0x80, 0x07, 0x78, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* W	*/
-0x33, 0x33, 0x33, 0x33, 0xf3, 0x3f, 0xff, 0xe3, 0x1f, 0xfe, 0xc1, 0x0c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* X	*/
-0xce, 0x71, 0x38, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Y	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Z	*/
-0xc0, 0x01, 0x38, 0x80, 0x03, 0x30, 0x00, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* bracketleft	*/
-0xe0, 0x00, 0x07, 0x70, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* backslash	*/
-0x3e, 0x73, 0x00, 0x07, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x01, 0x1c, 0x80, 0x03, 0x38, 0x00, 0x03, 0x30, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0x00, 0x00,  0x00,
-/* bracketright	*/
-0x1c, 0x80, 0x03, 0x38, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* asciicircum	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* numbersign	*/
-0xff, 0xc3, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* underscore	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* a	*/
-0xff, 0x31, 0x38, 0x83, 0x33, 0x38, 0x83, 0xf3, 0x1f, 0xff, 0xf1, 0x0f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* b	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x30, 0x07, 0xe3, 0x3f, 0xfe, 0xc3, 0x3f, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* c	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x38, 0x80, 0xf3, 0x1f, 0xff, 0xf1, 0x0f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* d	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x38, 0x83, 0xf3, 0x1f, 0xff, 0xf1, 0x0f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* e	*/
-0xff, 0x03, 0x30, 0x00, 0x03, 0x38, 0x80, 0xc3, 0x1f, 0xfc, 0xc1, 0x0f, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* f	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* g	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x38, 0x83, 0xf3, 0x1f, 0xff, 0xf1, 0x0f, 0xff, 0x30, 0x00, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x0f, 0xfe, 0xc0, 0x0f, 0xf8, 0x00, 0x00, 0x00,  0x00,
-/* h	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* i	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* j	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* k	*/
-0xf8, 0xc0, 0x0d, 0xdc, 0xe0, 0x0c, 0xce, 0x70, 0x0c, 0xc7, 0x30, 0x0c, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* l	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* m	*/
-0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* n	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* o	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* p	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x30, 0x07, 0xe3, 0x3f, 0xfe, 0xc3, 0x3f, 0xf8, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00,  0x00,
-/* q	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x38, 0x83, 0xf3, 0x1f, 0xff, 0xf1, 0x0f, 0x7f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00,  0x00,
-/* r	*/
-0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* s	*/
-0xfe, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 0xe0, 0x3f, 0xfe, 0xc3, 0x3f, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* t	*/
-0x30, 0x00, 0x03, 0x30, 0x80, 0x03, 0x38, 0xc0, 0x01, 0x1c, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* u	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x38, 0x83, 0xf3, 0x1f, 0xff, 0xf1, 0x0f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* v	*/
-0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0f, 0xfc, 0x80, 0x07, 0x78, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* w	*/
-0x33, 0x33, 0x33, 0x33, 0xf3, 0x3f, 0xff, 0xe3, 0x1f, 0xfe, 0xc1, 0x0c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* x	*/
-0x78, 0xc0, 0x0f, 0xfc, 0xe0, 0x1c, 0xce, 0x71, 0x38, 0x87, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* y	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x38, 0x83, 0xf3, 0x1f, 0xff, 0xf1, 0x0f, 0x7f, 0x30, 0x00, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x0f, 0xfe, 0xc0, 0x0f, 0xf8, 0x00, 0x00, 0x00,  0x00,
-/* z	*/
-0x70, 0x00, 0x0e, 0xe0, 0x00, 0x1c, 0xc0, 0xf1, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* braceleft	*/
-0xc7, 0xf0, 0x00, 0x0f, 0xf0, 0x01, 0x1f, 0xb0, 0x03, 0x3b, 0x30, 0x03, 0x33, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00,  0x00,
-/* bar	*/
-0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* braceright	*/
-0xc7, 0xf3, 0x00, 0x0f, 0xf0, 0x01, 0x1f, 0xb0, 0x03, 0x3b, 0x30, 0x03, 0x33, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00,  0x00,
-/* divide	*/
-0x00, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* block	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-};
-
-
-
-
-
-static uint8_t font_graphic[] = {
-/* space	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic01	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic02	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic03	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic04	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic05	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic06	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic07	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic08	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic09	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic10	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic11	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic12	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic13	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic14	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic15	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic16	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic17	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic18	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic19	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic20	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic21	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic22	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic23	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic24	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic25	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic26	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic27	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic28	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic29	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic30	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic31	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* at	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x1f, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x3f, 0xe3, 0x31, 0x00, 0x03, 0x38, 0xfc, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* A	*/
-0x30, 0x80, 0x07, 0xfc, 0xe0, 0x1c, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* B	*/
-0xfc, 0xe3, 0x3f, 0x07, 0x33, 0x30, 0x03, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0x07, 0x33, 0x30, 0x03, 0x73, 0x30, 0xfe, 0xc3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* C	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x03, 0x73, 0x38, 0xfe, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* D	*/
-0xfc, 0xe3, 0x3f, 0x07, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x73, 0x30, 0xfe, 0xc3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* E	*/
-0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xff, 0xf3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* F	*/
-0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* G	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x0f, 0xf3, 0x30, 0x03, 0x33, 0x38, 0xff, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* H	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* I	*/
-0xfc, 0xc0, 0x0f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0xfc, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* J	*/
-0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x73, 0x38, 0xfe, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* K	*/
-0x03, 0x73, 0x30, 0x0e, 0xc3, 0x31, 0x38, 0x03, 0x37, 0xe0, 0x03, 0x3e, 0x70, 0x83, 0x33, 0x1c, 0xe3, 0x30, 0x07, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* L	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xff, 0xf3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* M	*/
-0x03, 0x73, 0x38, 0xcf, 0xf3, 0x3f, 0x7b, 0x33, 0x33, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* N	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x38, 0xc3, 0x33, 0x3e, 0x73, 0xb3, 0x33, 0x1f, 0xf3, 0x30, 0x07, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* O	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0xfe, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* P	*/
-0xfc, 0xe3, 0x3f, 0x07, 0x33, 0x30, 0x03, 0x73, 0x30, 0xfe, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Q	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0xb3, 0x33, 0x1c, 0xe3, 0x38, 0xf7, 0x31, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* R	*/
-0xfc, 0xe3, 0x3f, 0x07, 0x33, 0x30, 0x03, 0x73, 0x30, 0xfe, 0xc3, 0x3f, 0x70, 0x83, 0x33, 0x1c, 0xe3, 0x30, 0x07, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* S	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x00, 0x03, 0x38, 0xfc, 0xe1, 0x0f, 0x07, 0x30, 0x00, 0x03, 0x73, 0x38, 0xfe, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* T	*/
-0xff, 0xf3, 0x3f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* U	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0xfe, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* V	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0xce, 0xc1, 0x0c, 0xcc, 0xc0, 0x0f, 0x78, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* W	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xf3, 0x3f, 0xfe, 0xc1, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* X	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0xce, 0xc1, 0x0f, 0x78, 0x80, 0x07, 0xfc, 0xe0, 0x1c, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Y	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0xce, 0xc1, 0x0f, 0x78, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Z	*/
-0xff, 0xf3, 0x3f, 0x03, 0x70, 0x00, 0x0e, 0xc0, 0x01, 0x38, 0x00, 0x07, 0xe0, 0x00, 0x1c, 0x80, 0x03, 0x30, 0xff, 0xf3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* bracketleft	*/
-0x00, 0x00, 0x00, 0x30, 0x00, 0x07, 0xe0, 0x00, 0x1c, 0xff, 0xf3, 0x3f, 0xc0, 0x01, 0x0e, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* backslash	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x3c, 0xe3, 0x33, 0x07, 0x70, 0x00, 0x0e, 0xc0, 0x01, 0x38, 0x00, 0x03, 0x3f, 0xf0, 0x03, 0x00,  0x00,
-/* bracketright	*/
-0x00, 0x00, 0x00, 0x30, 0x80, 0x03, 0x1c, 0xe0, 0x00, 0xff, 0xf3, 0x3f, 0x0e, 0xc0, 0x01, 0x38, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* asciicircum	*/
-0x00, 0x00, 0x00, 0x30, 0x80, 0x07, 0xfc, 0xe0, 0x1f, 0xf7, 0x33, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* numbersign	*/
-0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xff, 0xf3, 0x3f, 0xcc, 0xc0, 0x0c, 0xff, 0xf3, 0x3f, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic32	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic33	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic34	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic35	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic36	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic37	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic38	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic39	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic40	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic41	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic42	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic43	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic44	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic45	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic46	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic47	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic48	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic49	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic50	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic51	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic52	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic53	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic54	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic55	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic56	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic57	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic58	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic59	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic60	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic61	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic62	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic63	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-};
-
-
-static uint8_t font_sep_graphic[] = {
-/* space	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic01	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic02	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic03	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic04	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic05	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic06	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic07	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic08	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic09	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic10	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic11	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic12	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic13	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic14	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic15	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic16	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic17	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic18	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic19	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic20	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic21	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic22	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic23	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic24	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic25	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic26	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic27	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic28	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic29	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic30	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00,  0x00,
-/* graphic31	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* at	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x1f, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x3f, 0xe3, 0x31, 0x00, 0x03, 0x38, 0xfc, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* A	*/
-0x30, 0x80, 0x07, 0xfc, 0xe0, 0x1c, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* B	*/
-0xfc, 0xe3, 0x3f, 0x07, 0x33, 0x30, 0x03, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0x07, 0x33, 0x30, 0x03, 0x73, 0x30, 0xfe, 0xc3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* C	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x03, 0x73, 0x38, 0xfe, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* D	*/
-0xfc, 0xe3, 0x3f, 0x07, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x73, 0x30, 0xfe, 0xc3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* E	*/
-0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xff, 0xf3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* F	*/
-0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* G	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x0f, 0xf3, 0x30, 0x03, 0x33, 0x38, 0xff, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* H	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* I	*/
-0xfc, 0xc0, 0x0f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0xfc, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* J	*/
-0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x73, 0x38, 0xfe, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* K	*/
-0x03, 0x73, 0x30, 0x0e, 0xc3, 0x31, 0x38, 0x03, 0x37, 0xe0, 0x03, 0x3e, 0x70, 0x83, 0x33, 0x1c, 0xe3, 0x30, 0x07, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* L	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xff, 0xf3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* M	*/
-0x03, 0x73, 0x38, 0xcf, 0xf3, 0x3f, 0x7b, 0x33, 0x33, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* N	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x38, 0xc3, 0x33, 0x3e, 0x73, 0xb3, 0x33, 0x1f, 0xf3, 0x30, 0x07, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* O	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0xfe, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* P	*/
-0xfc, 0xe3, 0x3f, 0x07, 0x33, 0x30, 0x03, 0x73, 0x30, 0xfe, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Q	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0xb3, 0x33, 0x1c, 0xe3, 0x38, 0xf7, 0x31, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* R	*/
-0xfc, 0xe3, 0x3f, 0x07, 0x33, 0x30, 0x03, 0x73, 0x30, 0xfe, 0xc3, 0x3f, 0x70, 0x83, 0x33, 0x1c, 0xe3, 0x30, 0x07, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* S	*/
-0xfc, 0xe0, 0x1f, 0x87, 0x33, 0x30, 0x00, 0x03, 0x38, 0xfc, 0xe1, 0x0f, 0x07, 0x30, 0x00, 0x03, 0x73, 0x38, 0xfe, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* T	*/
-0xff, 0xf3, 0x3f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* U	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0xfe, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* V	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0xce, 0xc1, 0x0c, 0xcc, 0xc0, 0x0f, 0x78, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* W	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xf3, 0x3f, 0xfe, 0xc1, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* X	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0xce, 0xc1, 0x0f, 0x78, 0x80, 0x07, 0xfc, 0xe0, 0x1c, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Y	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0xce, 0xc1, 0x0f, 0x78, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Z	*/
-0xff, 0xf3, 0x3f, 0x03, 0x70, 0x00, 0x0e, 0xc0, 0x01, 0x38, 0x00, 0x07, 0xe0, 0x00, 0x1c, 0x80, 0x03, 0x30, 0xff, 0xf3, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* bracketleft	*/
-0x00, 0x00, 0x00, 0x30, 0x00, 0x07, 0xe0, 0x00, 0x1c, 0xff, 0xf3, 0x3f, 0xc0, 0x01, 0x0e, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* backslash	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x3c, 0xe3, 0x33, 0x07, 0x70, 0x00, 0x0e, 0xc0, 0x01, 0x38, 0x00, 0x03, 0x3f, 0xf0, 0x03, 0x00,  0x00,
-/* bracketright	*/
-0x00, 0x00, 0x00, 0x30, 0x80, 0x03, 0x1c, 0xe0, 0x00, 0xff, 0xf3, 0x3f, 0x0e, 0xc0, 0x01, 0x38, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* asciicircum	*/
-0x00, 0x00, 0x00, 0x30, 0x80, 0x07, 0xfc, 0xe0, 0x1f, 0xb7, 0x33, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* numbersign	*/
-0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xff, 0xf3, 0x3f, 0xcc, 0xc0, 0x0c, 0xff, 0xf3, 0x3f, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic32	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic33	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic34	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic35	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic36	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic37	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic38	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic39	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic40	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic41	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic42	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic43	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic44	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic45	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic46	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00,  0x00,
-/* graphic47	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic48	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic49	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic50	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic51	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic52	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic53	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic54	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic55	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic56	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic57	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic58	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic59	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic60	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic61	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic62	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-/* graphic63	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00,  0x00,
-};
-
-
-static uint8_t font_sep_graphic_dh_lower[] = {
-/* space	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic01	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic02	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic03	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic04	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic05	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic06	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic07	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic08	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic09	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic10	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic11	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic12	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic13	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic14	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic15	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic16	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic17	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic18	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic19	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic20	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic21	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic22	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic23	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic24	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic25	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic26	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic27	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic28	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic29	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic30	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00,  0x00,
-/* graphic31	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* at	*/
-0x1e, 0x03, 0x30, 0x00, 0x03, 0x38, 0x80, 0xc3, 0x1f, 0xfc, 0xc1, 0x0f, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* A	*/
-0xff, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* B	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x30, 0x07, 0xe3, 0x3f, 0xfe, 0xc3, 0x3f, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* C	*/
-0x00, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* D	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x30, 0x07, 0xe3, 0x3f, 0xfe, 0xc3, 0x3f, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* E	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* F	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* G	*/
-0x0f, 0x33, 0x30, 0x03, 0x33, 0x38, 0x83, 0xf3, 0x1f, 0xff, 0xf1, 0x0f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* H	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* I	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* J	*/
-0x03, 0x30, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* K	*/
-0x38, 0xc3, 0x31, 0x1c, 0xe3, 0x30, 0x0e, 0x73, 0x30, 0x07, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* L	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* M	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* N	*/
-0x0f, 0x73, 0x30, 0x07, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* O	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* P	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Q	*/
-0x3b, 0xc3, 0x31, 0x1c, 0xe3, 0x38, 0x8e, 0x73, 0x1f, 0xf7, 0xb1, 0x0f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* R	*/
-0x38, 0xc3, 0x31, 0x1c, 0xe3, 0x30, 0x0e, 0x73, 0x30, 0x07, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* S	*/
-0x03, 0x30, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* T	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* U	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* V	*/
-0xfc, 0x80, 0x07, 0x78, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* W	*/
-0x33, 0x33, 0x33, 0x33, 0xf3, 0x3f, 0xff, 0xe3, 0x1f, 0xfe, 0xc1, 0x0c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* X	*/
-0xce, 0x71, 0x38, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Y	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Z	*/
-0xc0, 0x01, 0x38, 0x80, 0x03, 0x30, 0x00, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* bracketleft	*/
-0xe0, 0x00, 0x07, 0x70, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* backslash	*/
-0x3e, 0x73, 0x00, 0x07, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x01, 0x1c, 0x80, 0x03, 0x38, 0x00, 0x03, 0x30, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0x00, 0x00,  0x00,
-/* bracketright	*/
-0x1c, 0x80, 0x03, 0x38, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* asciicircum	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* numbersign	*/
-0xff, 0xc3, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic32	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic33	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic34	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic35	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic36	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic37	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic38	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic39	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic40	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic41	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic42	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic43	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic44	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic45	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic46	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00,  0x00,
-/* graphic47	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic48	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic49	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic50	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic51	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic52	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic53	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic54	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic55	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic56	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic57	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic58	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic59	*/
-0x3e, 0xe0, 0x03, 0x3e, 0x00, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic60	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic61	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic62	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-/* graphic63	*/
-0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00, 0xe0, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0x0f, 0x00, 0x00,  0x00,
-};
-
-
-static uint8_t font_sep_graphic_dh_upper [] = {
-/* space	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic01	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic02	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic03	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic04	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic05	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic06	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic07	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic08	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic09	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic10	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic11	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic12	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic13	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic14	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic15	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic16	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic17	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic18	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic19	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic20	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic21	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic22	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic23	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic24	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic25	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic26	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic27	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic28	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic29	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic30	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic31	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* at	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x1f, 0xf3, 0x31, 0x3f, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0xf3, 0x33, 0x1e,  0x03,
-/* A	*/
-0x30, 0x00, 0x03, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xce, 0xe1, 0x1c, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0xff,  0x03,
-/* B	*/
-0xfc, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03,  0x03,
-/* C	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* D	*/
-0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* E	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0xfc, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* F	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0xfc, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* G	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x0f, 0xf3, 0x30, 0x0f,  0x03,
-/* H	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* I	*/
-0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* J	*/
-0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03,  0x00,
-/* K	*/
-0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0x0e, 0xe3, 0x30, 0x1c, 0xc3, 0x31, 0x38, 0x83, 0x33, 0x70, 0x03, 0x37, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x70, 0x03, 0x37, 0x38,  0x03,
-/* L	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* M	*/
-0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xcf, 0xf3, 0x3c, 0xff, 0xf3, 0x3f, 0x7b, 0xb3, 0x37, 0x33, 0x33, 0x33, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* N	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x83, 0x33, 0x38, 0xc3, 0x33, 0x3c, 0xe3, 0x33, 0x3e, 0x73, 0x33, 0x37, 0x3b, 0xb3, 0x33, 0x1f, 0xf3, 0x31, 0x0f,  0x03,
-/* O	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* P	*/
-0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0xfc, 0x83, 0x3f, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* Q	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0x33, 0x33, 0x3b,  0x03,
-/* R	*/
-0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0xfc, 0xc3, 0x3f, 0x70, 0x03, 0x37, 0x38,  0x03,
-/* S	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x00, 0x03, 0x30, 0x80, 0x03, 0x3c, 0xf0, 0xc1, 0x1f, 0xfe, 0xe0, 0x03, 0x0f, 0x70, 0x00, 0x03,  0x00,
-/* T	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* U	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* V	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xfc,  0x00,
-/* W	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,  0x03,
-/* X	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xfc, 0xc0, 0x0f, 0x78, 0x80, 0x07, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xce,  0x01,
-/* Y	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xfc, 0xc0, 0x0f, 0x78, 0x80, 0x07, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* Z	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x03, 0x30, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0,  0x01,
-/* bracketleft	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x01, 0x1c, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xc0, 0x01, 0x1c, 0xe0,  0x00,
-/* backslash	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x3c, 0xc3, 0x33, 0x3e,  0x03,
-/* bracketright	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x38, 0x80, 0x03, 0x1c, 0xc0, 0x01, 0x0e, 0xe0, 0x00, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x0e, 0xe0, 0x00, 0x1c,  0x00,
-/* asciicircum	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0xb7, 0x73, 0x3b, 0x33, 0x33, 0x33, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* numbersign	*/
-0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xff, 0xf3, 0x3f, 0xff,  0x03,
-/* graphic32	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic33	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic34	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic35	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic36	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic37	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic38	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic39	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic40	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic41	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic42	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic43	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic44	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic45	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic46	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic47	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic48	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic49	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic50	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic51	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic52	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic53	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic54	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic55	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80,  0x0f,
-/* graphic56	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic57	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic58	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic59	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e,  0x00,
-/* graphic60	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic61	*/
-0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x80, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic62	*/
-0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-/* graphic63	*/
-0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0x00, 0x00, 0x00, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe, 0xef, 0xfb, 0xbe,  0x0f,
-};
-
-static uint8_t font_graphic_dh_upper[] = {
-/* space	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic01	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic02	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic03	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic04	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic05	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic06	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic07	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic08	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic09	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic10	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic11	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic12	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic13	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic14	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic15	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic16	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic17	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic18	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic19	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic20	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic21	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic22	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic23	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic24	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic25	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic26	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic27	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic28	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic29	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic30	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic31	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* at	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x1f, 0xf3, 0x31, 0x3f, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0xf3, 0x33, 0x1e,  0x03,
-/* A	*/
-0x30, 0x00, 0x03, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xce, 0xe1, 0x1c, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0xff,  0x03,
-/* B	*/
-0xfc, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03,  0x03,
-/* C	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* D	*/
-0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* E	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0xfc, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* F	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xfc, 0xc3, 0x3f, 0xfc, 0xc3, 0x3f, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* G	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x0f, 0xf3, 0x30, 0x0f,  0x03,
-/* H	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* I	*/
-0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* J	*/
-0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03,  0x00,
-/* K	*/
-0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0x0e, 0xe3, 0x30, 0x1c, 0xc3, 0x31, 0x38, 0x83, 0x33, 0x70, 0x03, 0x37, 0xe0, 0x03, 0x3e, 0xe0, 0x03, 0x3e, 0x70, 0x03, 0x37, 0x38,  0x03,
-/* L	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* M	*/
-0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xcf, 0xf3, 0x3c, 0xff, 0xf3, 0x3f, 0x7b, 0xb3, 0x37, 0x33, 0x33, 0x33, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* N	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x83, 0x33, 0x38, 0xc3, 0x33, 0x3c, 0xe3, 0x33, 0x3e, 0x73, 0x33, 0x37, 0x3b, 0xb3, 0x33, 0x1f, 0xf3, 0x31, 0x0f,  0x03,
-/* O	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* P	*/
-0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0xfc, 0x83, 0x3f, 0x00, 0x03, 0x30, 0x00,  0x03,
-/* Q	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0x33, 0x33, 0x3b,  0x03,
-/* R	*/
-0xf8, 0xc3, 0x3f, 0xfe, 0xe3, 0x3f, 0x07, 0x73, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x07, 0x73, 0x30, 0xfe, 0xe3, 0x3f, 0xfc, 0xc3, 0x3f, 0x70, 0x03, 0x37, 0x38,  0x03,
-/* S	*/
-0x78, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0x87, 0x73, 0x38, 0x03, 0x33, 0x30, 0x00, 0x03, 0x30, 0x80, 0x03, 0x3c, 0xf0, 0xc1, 0x1f, 0xfe, 0xe0, 0x03, 0x0f, 0x70, 0x00, 0x03,  0x00,
-/* T	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* U	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03,  0x03,
-/* V	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xfc,  0x00,
-/* W	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,  0x03,
-/* X	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xfc, 0xc0, 0x0f, 0x78, 0x80, 0x07, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xce,  0x01,
-/* Y	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x87, 0x73, 0x38, 0xce, 0xe1, 0x1c, 0xfc, 0xc0, 0x0f, 0x78, 0x80, 0x07, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* Z	*/
-0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x03, 0x30, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xe0, 0x00, 0x1c, 0xc0, 0x01, 0x38, 0x80, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0,  0x01,
-/* bracketleft	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x01, 0x1c, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xc0, 0x01, 0x1c, 0xe0,  0x00,
-/* backslash	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x3c, 0xc3, 0x33, 0x3e,  0x03,
-/* bracketright	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x38, 0x80, 0x03, 0x1c, 0xc0, 0x01, 0x0e, 0xe0, 0x00, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0x0e, 0xe0, 0x00, 0x1c,  0x00,
-/* asciicircum	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x78, 0x80, 0x07, 0xfc, 0xc0, 0x0f, 0xfe, 0xe1, 0x1f, 0xb7, 0x73, 0x3b, 0x33, 0x33, 0x33, 0x30, 0x00, 0x03, 0x30,  0x00,
-/* numbersign	*/
-0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xff, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xff, 0xf3, 0x3f, 0xff,  0x03,
-/* graphic32	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic33	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic34	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic35	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic36	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic37	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic38	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic39	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic40	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic41	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic42	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic43	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic44	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic45	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic46	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic47	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic48	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic49	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic50	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic51	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic52	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic53	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic54	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic55	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic56	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic57	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic58	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic59	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic60	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic61	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic62	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic63	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-};
-
-
-static uint8_t font_graphic_dh_lower[] = {
-/* space	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic01	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic02	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic03	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic04	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic05	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic06	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic07	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic08	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic09	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic10	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic11	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic12	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic13	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic14	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic15	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic16	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic17	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic18	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic19	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic20	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic21	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic22	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic23	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic24	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic25	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic26	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic27	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic28	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic29	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic30	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* graphic31	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0,  0x0f,
-/* at	*/
-0x1e, 0x03, 0x30, 0x00, 0x03, 0x38, 0x80, 0xc3, 0x1f, 0xfc, 0xc1, 0x0f, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* A	*/
-0xff, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* B	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x30, 0x07, 0xe3, 0x3f, 0xfe, 0xc3, 0x3f, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* C	*/
-0x00, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* D	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x30, 0x07, 0xe3, 0x3f, 0xfe, 0xc3, 0x3f, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* E	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* F	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* G	*/
-0x0f, 0x33, 0x30, 0x03, 0x33, 0x38, 0x83, 0xf3, 0x1f, 0xff, 0xf1, 0x0f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* H	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* I	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* J	*/
-0x03, 0x30, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* K	*/
-0x38, 0xc3, 0x31, 0x1c, 0xe3, 0x30, 0x0e, 0x73, 0x30, 0x07, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* L	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* M	*/
-0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* N	*/
-0x0f, 0x73, 0x30, 0x07, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* O	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* P	*/
-0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Q	*/
-0x3b, 0xc3, 0x31, 0x1c, 0xe3, 0x38, 0x8e, 0x73, 0x1f, 0xf7, 0xb1, 0x0f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* R	*/
-0x38, 0xc3, 0x31, 0x1c, 0xe3, 0x30, 0x0e, 0x73, 0x30, 0x07, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* S	*/
-0x03, 0x30, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* T	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* U	*/
-0x03, 0x33, 0x30, 0x03, 0x73, 0x38, 0x87, 0xe3, 0x1f, 0xfe, 0xc1, 0x0f, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* V	*/
-0xfc, 0x80, 0x07, 0x78, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* W	*/
-0x33, 0x33, 0x33, 0x33, 0xf3, 0x3f, 0xff, 0xe3, 0x1f, 0xfe, 0xc1, 0x0c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* X	*/
-0xce, 0x71, 0x38, 0x87, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Y	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* Z	*/
-0xc0, 0x01, 0x38, 0x80, 0x03, 0x30, 0x00, 0xf3, 0x3f, 0xff, 0xf3, 0x3f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* bracketleft	*/
-0xe0, 0x00, 0x07, 0x70, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* backslash	*/
-0x3e, 0x73, 0x00, 0x07, 0x70, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0xc0, 0x01, 0x1c, 0x80, 0x03, 0x38, 0x00, 0x03, 0x30, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0x00, 0x00, 0x00,  0x00,
-/* bracketright	*/
-0x1c, 0x80, 0x03, 0x38, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* asciicircum	*/
-0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* numbersign	*/
-0xff, 0xc3, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0xc0, 0x0c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00,
-/* graphic32	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic33	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic34	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic35	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic36	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0xff, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic37	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0xff, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic38	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0xff, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic39	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0xff, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic40	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic41	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic42	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic43	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic44	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic45	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic46	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic47	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f,  0x00,
-/* graphic48	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic49	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic50	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic51	*/
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic52	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic53	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic54	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic55	*/
-0xc0, 0x0f, 0xfc, 0xc0, 0x0f, 0xfc, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic56	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic57	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic58	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic59	*/
-0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic60	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic61	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic62	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-/* graphic63	*/
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  0x0f,
-};
-
-
-
-/* Font list, selected with following bits:
-   1 - double height
-   2 - 2nd row of double height
-   4 - graphics
-   8 - separated mode
-*/
-
-uint8_t *font_list[16] = {
-  font_std,
-  font_std_dh_upper,
-  font_std,			/* 2nd row, but this char not double	*/
-  font_std_dh_lower,
-  font_graphic,
-  font_graphic_dh_upper,
-  font_graphic,
-  font_graphic_dh_lower,
-  font_std,
-  font_std_dh_upper,
-  font_std,
-  font_std_dh_lower,
-  font_sep_graphic,
-  font_sep_graphic_dh_upper,
-  font_sep_graphic,
-  font_sep_graphic_dh_lower};
-
 static void print_one_font(const char *name, const uint8_t *font)
 {
 	unsigned ch, row, x;
@@ -1847,7 +252,10 @@ static void print_one_font(const char *name, const uint8_t *font)
 	// We want to keep the ordering, but unpack into 16 bits/character
 	// with the high bits in each word zero.
 	// There are 19 rows in each character, but we want 20, so we duplicate
-	// the last row. (which is always blank anyhow except in the DH fonts)
+	// the last row. (which is always blank anyhow).
+	// Double height is done at runtime by the renderer, by doubling up
+	// the rows of this font, and the mosaic graphics are generated from
+	// the character codes so don't need a font.
 	unsigned last_nonzero = 0;
 	unsigned save_bits;
 
@@ -1898,16 +306,8 @@ static void print_one_font(const char *name, const uint8_t *font)
 
 int main(int argc, char **argv)
 {
-	puts("#include \"mode7_demo.h\"");
+	puts("#include \"mode7_render.h\"");
 	puts(copyright);
 	print_one_font("font_std", font_std);
-	print_one_font("font_std_dh_upper", font_std_dh_upper);
-	print_one_font("font_std_dh_lower", font_std_dh_lower);
-	print_one_font("font_graphic", font_graphic);
-	print_one_font("font_graphic_dh_upper", font_graphic_dh_upper);
-	print_one_font("font_graphic_dh_lower", font_graphic_dh_lower);
-	print_one_font("font_sep_graphic", font_sep_graphic);
-	print_one_font("font_sep_graphic_dh_upper", font_sep_graphic_dh_upper);
-	print_one_font("font_sep_graphic_dh_lower", font_sep_graphic_dh_lower);
 	return 0;
 }
@@ -1,4 +1,6 @@
 #include "mode7_demo.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
 
 // Our video output programs for the PIO
 #include "mode7.pio.h"
@@ -65,69 +67,94 @@
 */
 
 
-#define	LINE_T	(SYSCLK_MHZ * 64)			// 64us
-#define	HSYNC_T	((SYSCLK_MHZ *47) / 10)		// 4.7us
-#define	VSYNC_T	(SYSCLK_MHZ * 160)			// 160us = 2.5 lines
+// Times in cycles of the system clock, which the PIO program runs at
+#define	LINE_T	(mhz * 64)					// 64us
+#define	HSYNC_T	((mhz * 47) / 10)			// 4.7us
+#define	VSYNC_T	(mhz * 160)					// 160us = 2.5 lines
 
 
-// Wrapper function for writing the values to the FIFO:
-// combines the low and high times and subtracts 2 from each to
+// Combines the low and high times and subtracts 2 from each to
 // fit what the PIO program actually does
-static __force_inline void write_value(unsigned low, unsigned high)
+static __force_inline uint32_t sync_value(unsigned low, unsigned high)
 {
-	PIO pio = VIDEO_PIO;
-	pio->txf[VIDEO_SYNCGEN_SM] = (low -2) | ((high -2) << 16);
+	return (low -2) | ((high -2) << 16);
 }
 
-
-// Assumes this is the only interrupt on the video PIO
-// (other functions use DMA or polling)
-static void __not_in_flash_func(pio_irq0_handler)(void)
+// Fill in the FIFO values for a whole frame, for syncgen_set_table().
+// Note that this line_no is counting our pulses (where one VSYNC pulse
+// straddles multiple lines), so it doesn't quite count up to 625.
+// mhz is the system clock.
+void syncgen_make_frame(uint32_t *table, unsigned mhz)
 {
-	// Note that this line_no is counting our pulses (where one VSYNC pulse
-	// straddles multiple lines), so it doesn't quite count up to 625.
-	static unsigned line_no = 0;
-	switch (line_no++)
+	for (unsigned line_no = 0; line_no < SYNC_FRAME_PULSES; line_no++)
 	{
-		case 0:
-			// This is the VSYNC of the first field with short gap after it
-			// to the first HSYNC (17us) so total 113us
-			// Added to the 15us for the trailing line of the last frame,
-			// that gives 128 total (2 lines).
-			write_value(VSYNC_T, (SYSCLK_MHZ * 17));
-			break;
-		// 309 ordinary lines in between, total 19840us
-		case 310:
-			// This is the last HSYNC before the 2nd field VSYNC
-			// with a large gap (total 47us)
-			write_value(HSYNC_T, (SYSCLK_MHZ * 47) - HSYNC_T);
-			break;
-		case 311:
-			// This is the VSYNC at the top of the 2nd field
-			// and the 49us gap to the next HSYNC (total 209)
-			// Combined with the 47us just before totals 256us (4 lines)
-			write_value(VSYNC_T, (SYSCLK_MHZ * 49));
-			break;
-		// 309 ordinary lines in between
-		case 621:
-			// This is the last HSYNC before restarting for the next frame
-			// so small gap before the VSYNC (total 15us)
-			write_value(HSYNC_T, (SYSCLK_MHZ * 15) - HSYNC_T);
-			line_no = 0;
-			break;
-		default:
-			// Standard line, total 64us
-			write_value(HSYNC_T, LINE_T - HSYNC_T);	
-			break;
+		switch (line_no)
+		{
+			case 0:
+				// This is the VSYNC of the first field with short gap after
+				// it to the first HSYNC (17us) so total 113us
+				// Added to the 15us for the trailing line of the last frame,
+				// that gives 128 total (2 lines).
+				table[line_no] = sync_value(VSYNC_T, (mhz * 17));
+				break;
+			// 309 ordinary lines in between, total 19840us
+			case 310:
+				// This is the last HSYNC before the 2nd field VSYNC
+				// with a large gap (total 47us)
+				table[line_no] = sync_value(HSYNC_T,
+					(mhz * 47) - HSYNC_T);
+				break;
+			case 311:
+				// This is the VSYNC at the top of the 2nd field
+				// and the 49us gap to the next HSYNC (total 209)
+				// Combined with the 47us just before totals 256us (4 lines)
+				table[line_no] = sync_value(VSYNC_T, (mhz * 49));
+				break;
+			// 309 ordinary lines in between
+			case 621:
+				// This is the last HSYNC before restarting for the next
+				// frame so small gap before the VSYNC (total 15us)
+				table[line_no] = sync_value(HSYNC_T,
+					(mhz * 15) - HSYNC_T);
+				break;
+			default:
+				// Standard line, total 64us
+				table[line_no] = sync_value(HSYNC_T, LINE_T - HSYNC_T);
+				break;
+		}
 	}
 }
 
+static uint32_t sync_frame[SYNC_FRAME_PULSES];
+
+// The sync words are fed to the PIO by a pair of DMA channels, with no
+// CPU involvement at all.  The data channel sends one frame's worth of
+// words, paced by the FIFO, and then chains to the control channel.
+// That copies sync_table into the data channel's read address trigger
+// register, which restarts it (the transfer count is reloaded on each
+// trigger) from the start of whichever table is current.
+static unsigned sync_data_dma, sync_ctrl_dma;
+static const uint32_t * volatile sync_table;
+
+// Switch to a different table of SYNC_FRAME_PULSES values, in the same
+// format as syncgen_make_frame() produces.  This is a single store, picked
+// up by the DMA when the current frame has finished, so the switch is
+// always at a frame boundary.  The old table is still in use until then.
+void syncgen_set_table(const uint32_t *table)
+{
+	sync_table = table;
+}
+
 
-// Set up the sync generator, which continues to run under interrupts.
-// Assumes sync handling is the only thing using irq0 on this PIO instance.
+// Set up the sync generator, which continues to run from DMA.
 void syncgen_start(void)
 {
 	unsigned offset;
+	dma_channel_config cfg;
+
+	syncgen_make_frame(sync_frame,
+		(clock_get_hz(clk_sys) + 500000) / 1000000);
+	sync_table = sync_frame;
 
 	// Load the PIO program
 	offset = pio_add_program(VIDEO_PIO, &sync_gen_program);
@@ -135,15 +162,24 @@ void syncgen_start(void)
 	// Initialise the PIO state machine
 	sync_gen_init(VIDEO_PIO, VIDEO_SYNCGEN_SM, offset);
 
-	// Hook the IRQ vector
-	irq_set_exclusive_handler((VIDEO_PIO == pio0) ? PIO0_IRQ_0 : PIO1_IRQ_0,
-		pio_irq0_handler);
-
-	// Enable IRQ in the NVIC
-	irq_set_enabled((VIDEO_PIO == pio0) ? PIO0_IRQ_0 : PIO1_IRQ_0, true);
-
-	// Enable IRQ in the PIO
-	// These enable bits are in order of SM number
-	hw_set_bits(&VIDEO_PIO->inte0,
-		(PIO_IRQ0_INTE_SM0_TXNFULL_BITS << VIDEO_SYNCGEN_SM));
+	sync_data_dma = dma_claim_unused_channel(true);
+	sync_ctrl_dma = dma_claim_unused_channel(true);
+
+	cfg = dma_channel_get_default_config(sync_data_dma);
+	channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+	channel_config_set_read_increment(&cfg, true);
+	channel_config_set_write_increment(&cfg, false);
+	channel_config_set_dreq(&cfg,
+		pio_get_dreq(VIDEO_PIO, VIDEO_SYNCGEN_SM, true));
+	channel_config_set_chain_to(&cfg, sync_ctrl_dma);
+	dma_channel_configure(sync_data_dma, &cfg,
+		&VIDEO_PIO->txf[VIDEO_SYNCGEN_SM], NULL, SYNC_FRAME_PULSES, false);
+
+	cfg = dma_channel_get_default_config(sync_ctrl_dma);
+	channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+	channel_config_set_read_increment(&cfg, false);
+	channel_config_set_write_increment(&cfg, false);
+	dma_channel_configure(sync_ctrl_dma, &cfg,
+		&dma_hw->ch[sync_data_dma].al3_read_addr_trig, &sync_table, 1,
+		true);
 }
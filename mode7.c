@@ -1,395 +1,834 @@
 
 #include "mode7_demo.h"
 
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/structs/scb.h"
+#include "pico/multicore.h"
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "mode7.pio.h"
 
-// Adjust BACK_PORCH and VERTICAL_POS to position the display on screen.
-
-// Back porch delay from falling edge of HSYNC to first pixel, in units
-// of the PIO clock.  Can tweak this to get the horizontal position right.
-// Official back-porch (rising HSYNC to video) is 5.7us, plus 4.7us for
-// HSYNC itself leaves 53.6us for active video, of which we actually use 40
-// so 13.6 spare, put 6.8 either side to centre it.
-// = 5.7+4.7+6.8 = 17.2us
-#define BACK_PORCH	(SYSCLK_MHZ * 172 / 10)
-
-// There are 320 video lines after the VSYNC, of which we output on 250.
-// So there's 70 blank lines to distribute in top/bottom border.
-// Even split would be 35, but I believe the gap at the top is normally
-// a bit smaller.  This is also not going to be 100% right between
-// Electron-style syncs (normal HSYNCs start right after VSYNC)
-// and proper PAL where there are equalising pulses.
-// This constant defines the number of skipped lines after the first
-// HSYNC detected after VSYNC.
-#define	VERTICAL_POS	30
-
-// Note that the current font was optimised to fit in a 640x480 VGA screen,
-// so had only 19 rows per character line.  It has now been stretched by
-// duplicating the last row (which is always zero on alpha characters anyhow),
-// but may not be right in the case of graphics.
-#define	ROWS_PER_LINE	20
-#define	FONT_ROWS		20
-
-
-
-/* Font list, indexed with following bits:
-   1 - double height
-   2 - 2nd row of double height
-   4 - graphics
-   8 - separated mode
-*/
-#define	BIT_DBL_HEIGHT	1
-#define	BIT_2ND_ROW_DH	2
-#define	BIT_GRAPHICS	4
-#define	BIT_SEPARATED	8
-static const uint16_t * const font_list[16] = {
-	font_std,
-	font_std_dh_upper,
-	font_std,                    /* 2nd row, but this char not double    */
-	font_std_dh_lower,
-	font_graphic,
-	font_graphic_dh_upper,
-	font_graphic,
-	font_graphic_dh_lower,
-	font_std,
-	font_std_dh_upper,
-	font_std,
-	font_std_dh_lower,
-	font_sep_graphic,
-	font_sep_graphic_dh_upper,
-	font_sep_graphic,
-	font_sep_graphic_dh_lower
-};
+// The renderer builds the PIO words from these, so they have to match
+// the program (which is loaded at offset 0)
+static_assert(mode7_output_offset_cell == MODE7_WORD_CELL, "MODE7_WORD_CELL");
+static_assert(mode7_output_offset_pair == MODE7_WORD_PAIR, "MODE7_WORD_PAIR");
+static_assert(mode7_output_offset_run == MODE7_WORD_RUN, "MODE7_WORD_RUN");
+static_assert(mode7_output_offset_eol == MODE7_WORD_EOL, "MODE7_WORD_EOL");
+
+// Timings for the system clock mode7_init() was given.  The PIO runs at
+// a multiple of 12MHz, which is also its cycles per character cell; the
+// sync measurement runs at the system clock.
+static unsigned pio_mhz;
+static unsigned sync_mhz;
+static uint32_t eol_word;
+
+// Compile option to feed the PIO from scanline buffers by DMA, rather than
+// the CPU writing each word to the FIFO as it is generated.
+#define	DMA_OUTPUT	1
+
+// Compile option to track the Electron's line rate, which is always
+// measured for the 'G' statistics, with the PIO clock divider (see
+// genlock_update()).  Off by default, as the divider can hardly ever act
+// on it.  A step of the divider is 1/256 of it, and a change needs 160/256
+// of a step, which is 0.24% at 96MHz, far more than crystals drift.
+// Also, at the default SYSCLK_MHZ of 96 the divider is already 1.0 and
+// can't go lower, so an Electron running fast can't be followed at all.
+#define	GENLOCK_SERVO	0
+
+// The sync_measure PIO program pushes a pair of words for every sync
+// pulse (see mode7.pio), which DMA copies into this ring.  The ring
+// never needs resetting: pairs always start at an even index.
+// 1024 bytes holds 128 pulses (8ms of lines), plenty as it only has to
+// hold the ones since wait_for_vsync() last looked.
+#define	SYNC_RING_BITS		10
+#define	SYNC_RING_WORDS		((1 << SYNC_RING_BITS) / 4)
+static uint32_t sync_ring[SYNC_RING_WORDS]
+	__attribute__((aligned(1 << SYNC_RING_BITS)));
+static unsigned sync_dma;
+
+// Pulse widths used to classify the syncs, in clk_sys cycles
+#define	SYNC_US(us)			(sync_mhz * (us))
+#define	LINE_CYCLES			SYNC_US(64)
+
+// Index in sync_ring[] of the next word DMA will write
+static __force_inline unsigned sync_ring_head(void)
+{
+	uintptr_t addr = dma_hw->ch[sync_dma].write_addr;
+	return ((addr - (uintptr_t)sync_ring) / 4) & (SYNC_RING_WORDS - 1);
+}
+
+// Start the sync measurement PIO program and DMA.  Must be called on the
+// core that will call wait_for_vsync(), as that's the one that sleeps.
+static void sync_measure_start(void)
+{
+	dma_channel_config cfg;
+	unsigned offset;
+
+	offset = pio_add_program(SYNC_PIO, &sync_measure_program);
+
+	sync_dma = dma_claim_unused_channel(true);
+	cfg = dma_channel_get_default_config(sync_dma);
+	channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+	channel_config_set_read_increment(&cfg, false);
+	channel_config_set_write_increment(&cfg, true);
+	channel_config_set_ring(&cfg, true, SYNC_RING_BITS);
+	channel_config_set_dreq(&cfg, pio_get_dreq(SYNC_PIO, SYNC_MEASURE_SM,
+		false));
+	// Runs for 38 hours at 2 words per line; wait_for_vsync() restarts it
+	dma_channel_configure(sync_dma, &cfg, sync_ring,
+		&SYNC_PIO->rxf[SYNC_MEASURE_SM], 0xffffffff, true);
+
+	// The PIO sets its IRQ flag at the end of each sync pulse.  That's
+	// not enabled in the NVIC, but with SEVONPEND the interrupt becoming
+	// pending is an event, so it wakes this core from WFE.
+	pio_set_irq0_source_enabled(SYNC_PIO,
+		pis_interrupt0 + SYNC_MEASURE_SM, true);
+	scb_hw->scr |= M0PLUS_SCR_SEVONPEND_BITS;
+
+	sync_measure_init(SYNC_PIO, SYNC_MEASURE_SM, offset);
+}
 
 // Wait for VSYNC and feed an appropriate number of dummy lines
 // into the PIO so that the next thing to go in the FIFO is the
 // pixel data for the first line.
 // Returns true if it's the odd field, false if even field
-static bool __force_inline wait_for_vsync(void)
+// The pulses are classified from the sync_measure records, and the
+// core sleeps between pulses rather than polling the pin.
+static bool __not_in_flash_func(wait_for_vsync)(void)
 {
-	uint32_t falling, rising, vsync_end, width;
-	bool got_vsync = false;
-
-	// Measure the width of low-going pulses.  Note that we don't check
-	// for the signal being high before entering the loop: worst thing that
-	// can happen is we see a pulse shorter than it really is, but we are
-	// first looking for a VSYNC - so we might mistake our VSYNC for an HSYNC,
-	// but otherwise we'd have missed it altogether so the effect is the same.
+	unsigned tail, head;
+	uint32_t now, falling, rising, vsync_end, width;
+	unsigned lines_late;
+	bool got_vsync = false, got_hsync = false;
+
+	// Don't want to keep going forever
+	if (!dma_channel_is_busy(sync_dma))
+		dma_channel_set_trans_count(sync_dma, 0xffffffff, true);
+
+	// Only interested in pulses from now on.  Start at the low part of
+	// the latest pulse, which has at least started.
+	tail = sync_ring_head() & ~1;
+	now = 0;
+	vsync_end = 0;
+	falling = 0;
+	lines_late = 0;
+
 	for (;;)
 	{
-		// Record timestamps of the rising and falling edges
-		while (gpio_get(PIN_SYNC_IN) != 0)
-			;
-		falling = time_us_32();
-		while (gpio_get(PIN_SYNC_IN) == 0)
-			;
-		rising = time_us_32();
-		width = rising - falling;	// Pulse width in microseconds approx
-		if (width > 25)
+		// Clear the wakeup before looking, so a pulse that ends after
+		// we've looked still wakes us up.
+		pio_interrupt_clear(SYNC_PIO, SYNC_MEASURE_SM);
+		irq_clear(SYNC_PIO_IRQ);
+
+		head = sync_ring_head();
+		while (tail != head)
 		{
-			// Seems like a VSYNC
-			got_vsync = true;
-			vsync_end = rising;
+			width = 2 * ~sync_ring[tail] + 4;
+			if (tail & 1)
+			{
+				// High part: now is the next falling edge
+				now += width;
+			}
+			else
+			{
+				// Low part: measure the width of low-going pulses
+				rising = now + width;
+				if (width > SYNC_US(25))
+				{
+					// Seems like a VSYNC
+					got_vsync = true;
+					got_hsync = false;
+					vsync_end = rising;
+				}
+				else if ((width < SYNC_US(7)) && (width > SYNC_US(2)))
+				{
+					// Seems like an HSYNC.  If we've already seen a
+					// VSYNC, the first is the one we want, and any more
+					// we're too late for.
+					if (got_hsync) lines_late++;
+					else if (got_vsync)
+					{
+						got_hsync = true;
+						falling = now;
+					}
+				}
+				now = rising;
+			}
+			tail = (tail + 1) & (SYNC_RING_WORDS - 1);
 		}
-		else if ((width < 7) && (width > 2))
+
+		// Done if we've caught up and found the first HSYNC after VSYNC:
+		// sync is high now, unless it's gone low for an HSYNC that's
+		// still in progress, which the PIO will count for us.
+		if (got_hsync)
 		{
-			// Seems like an HSYNC.  If we've already seen a VSYNC
-			// we are ready to go.
-			if (got_vsync) break;
+			if (lines_late < VERTICAL_POS) break;
+			// Much too late, so wait for the next one
+			got_vsync = got_hsync = false;
+			lines_late = 0;
 		}
+		__wfe();
 	}
-	// Sync has just gone high after the first HSYNC, so we can tell the
+	// Sync has gone high after the first HSYNC, so we can tell the
 	// PIO to start counting HSYNCs from here.
-	for (unsigned u = 0; u < VERTICAL_POS; u++)
-		pio_sm_put_blocking(VIDEO_PIO, VIDEO_MODE7_SM, BACK_PORCH << 16);
+	for (unsigned u = lines_late; u < VERTICAL_POS; u++)
+		pio_sm_put_blocking(VIDEO_PIO, VIDEO_MODE7_SM, eol_word);
 
 	// Here with vsync_end=timestamp of the rising edge of the VSYNC,
 	// falling=/ the falling edge of HSYNC.  For an Electron, they should be
 	// either 17 or 49us apart, indicating which field; however on
 	// proper video with equalising pulses there could be a multiple
-	// of 64us extra so we take the number mod 64
-	return (((falling - vsync_end) % 64) < 32);
+	// of 64us extra so we take the number mod 64us
+	return (((falling - vsync_end) % LINE_CYCLES) < LINE_CYCLES / 2);
 }
 
 
-// Generate one field of teletext display, with the PIO program handling
-// HSYNC timing and the expansion of 12 horizontal pixels.
-// This waits for VSYNC before starting, measures the relative HSYNC/VSYNC
-// timing to determine whether it is the odd or even field, and exits
-// after the last visible line.  Hence it should be called in a loop
-// to produce a continuous display, with the caller having a little time
-// to do some housekeeping between calls and still get there in time for
-// the next VSYNC.
-void __not_in_flash_func(mode7_display_field)
-	(const uint8_t *ttxt_buf, bool flash_on)
+#if DMA_OUTPUT
+
+// Two DMA channels alternate scanlines, each writing a scanline's words
+// from the line cache to the PIO FIFO, paced by the TX DREQ.  Once the
+// next scanline has been given to one channel, the other is chained to
+// it, so as soon as one scanline has gone the next is started without
+// any CPU involvement: the CPU only has to stay one scanline ahead, and
+// is otherwise free for the whole of each line.  A channel is only
+// chained on once there's something to chain to, so if the CPU falls
+// behind the PIO stalls (and TXSTALL says so) rather than being sent
+// whatever a channel was last pointed at.
+static unsigned line_dma[2];
+static dma_channel_config line_dma_cfg[2];
+
+// Words in the scanline each channel was last given, as the scanlines
+// vary in length
+static unsigned line_dma_count[2];
+
+// Queue a scanline for output.  The first scanline of the field is
+// started directly.  For the rest, wait until this channel has finished
+// with the scanline before last, point it at the new words, and then
+// chain the other channel, which has the last scanline, on to it.  If
+// that has already finished, the chain is too late, so start this one
+// here instead.
+static void __not_in_flash_func(output_scanline)(unsigned scanline,
+	const uint32_t *words, unsigned count, bool last)
 {
-	unsigned line;			// Which line out of the 25? (0..24)
-	unsigned row;			// Which pixel row within a line (0..19)
-	unsigned ch_pos;		// Which character within the line (0..39)
+	unsigned chan = scanline & 1;
+	dma_channel_config cfg;
+
+	// Any other work for core1 could go here rather than just spinning.
+	while (dma_channel_is_busy(line_dma[chan]))
+		tight_loop_contents();
+
+	// Set up without chaining on, as the next scanline isn't ready yet
+	dma_channel_set_config(line_dma[chan], &line_dma_cfg[chan], false);
+	dma_channel_set_trans_count(line_dma[chan], count, false);
+	line_dma_count[chan] = count;
+	dma_channel_set_read_addr(line_dma[chan], words, scanline == 0);
+	if (scanline == 0) return;
+
+	cfg = line_dma_cfg[chan ^ 1];
+	channel_config_set_chain_to(&cfg, line_dma[chan]);
+	dma_channel_set_config(line_dma[chan ^ 1], &cfg, false);
+
+	// If the other channel finished before the chain was set, this one
+	// is still idle with the read address untouched
+	if (!dma_channel_is_busy(line_dma[chan ^ 1])
+		&& !dma_channel_is_busy(line_dma[chan])
+		&& (dma_hw->ch[line_dma[chan]].read_addr == (uintptr_t)words))
+	{
+		dma_channel_start(line_dma[chan]);
+	}
+}
 
-	// Decode state - should be bits in a word
-	unsigned font_mode;		// BIT_DBL_HEIGHT etc.
+// Set up the DMA channels at the start of a field, neither chained on.
+static void line_dma_start_field(void)
+{
+	for (unsigned chan = 0; chan < 2; chan++)
+	{
+		// Should have long since finished the last field
+		dma_channel_wait_for_finish_blocking(line_dma[chan]);
+		dma_channel_configure(line_dma[chan], &line_dma_cfg[chan],
+			&VIDEO_PIO->txf[VIDEO_MODE7_SM], NULL, WORDS_PER_LINE, false);
+	}
+}
+
+static void line_dma_init(void)
+{
+	for (unsigned chan = 0; chan < 2; chan++)
+	{
+		line_dma[chan] = dma_claim_unused_channel(true);
+		line_dma_cfg[chan] = dma_channel_get_default_config(line_dma[chan]);
+		channel_config_set_transfer_data_size(&line_dma_cfg[chan],
+			DMA_SIZE_32);
+		channel_config_set_read_increment(&line_dma_cfg[chan], true);
+		channel_config_set_write_increment(&line_dma_cfg[chan], false);
+		channel_config_set_dreq(&line_dma_cfg[chan],
+			pio_get_dreq(VIDEO_PIO, VIDEO_MODE7_SM, true));
+		// Chaining to itself means not chaining on
+		channel_config_set_chain_to(&line_dma_cfg[chan], line_dma[chan]);
+	}
+}
 
-	bool hold_gr, flash, conceal;
+#else
 
-	bool dh_this_row;
+// Without DMA, the CPU copies the words into the FIFO, waiting for space
+// as it goes.
+static void __not_in_flash_func(output_scanline)(unsigned scanline,
+	const uint32_t *words, unsigned count, bool last)
+{
+	for (unsigned u = 0; u < count; u++)
+		pio_sm_put_blocking(VIDEO_PIO, VIDEO_MODE7_SM, words[u]);
+}
 
-	// Points to the current character within the 40x25 buffer
-	const uint8_t  *chp;
-	// Character value retrieved from *chp
-	unsigned ch;
+#endif
 
-	// Pointer to start of the currently selected font - each font starts
-	// at character value 0x20 and contains 96 characters, formatted
-	// as one row of pixels per 16-bit word.
-	const uint16_t *font;		
 
-	// fontp is the current character within the font, used only momentarily
-	const uint16_t *fontp;
+// FIFO slack statistics.  At the end of each scanline, ie. when the next
+// one has been rendered and is about to be queued, the number of words
+// still waiting to go to the PIO is sampled, and TXSTALL checked to see
+// whether the PIO ran out of words (which shows as a glitch on screen).
+// TXSTALL is checked once more when the PIO has had the last scanline.
+// Note that with runs of blank cells going as a single word, a word in
+// the FIFO can be anything from 1us to a whole line.
+// Written by core1 at the end of each field under a sequence count, like
+// the line cache statistics.
+static mode7_fifo_stats_t fifo_stats;
+static volatile uint32_t fifo_stats_seq;
+
+// Working counts for the current field
+static struct
+{
+	unsigned min_slack, min_scanline, samples, underruns, first_underrun;
+	unsigned scanlines;
+	uint32_t total_slack;
+} fifo_field;
 
-	// held_cell is a stashed fontp value for the character that is being
-	// 'held' in Hold Graphics mode.  Note that the held cell can be
-	// held from some time before the HG control code appears on the line,
-	// so this is distinct from the hold_gr flag that tells us whether or not
-	// to use the held character.
-	const uint16_t *held_cell;
+#define	TXSTALL_BIT		(1u << (PIO_FDEBUG_TXSTALL_LSB + VIDEO_MODE7_SM))
 
-#ifdef CONCEAL_SUPPORT
-	int enable_conceal = false;
+// Words queued ahead of the PIO when scanline is about to be queued
+static __force_inline unsigned fifo_slack(unsigned scanline)
+{
+	unsigned slack = pio_sm_get_tx_fifo_level(VIDEO_PIO, VIDEO_MODE7_SM);
+#if DMA_OUTPUT
+	unsigned chan = scanline & 1;
+
+	// This channel has the scanline before last, the other the last one,
+	// which won't have been started yet if this one is still busy.
+	if (dma_channel_is_busy(line_dma[chan]))
+	{
+		slack += dma_hw->ch[line_dma[chan]].transfer_count
+			+ line_dma_count[chan ^ 1];
+	}
+	else if (dma_channel_is_busy(line_dma[chan ^ 1]))
+		slack += dma_hw->ch[line_dma[chan ^ 1]].transfer_count;
 #endif
+	return slack;
+}
 
-	// Start on row 0 or 1 depending on whether this is odd or even field
-	if (wait_for_vsync()) row = 0;
-	else row = 1;
+// Start counting for a field, once the top border is in the FIFO.  The
+// PIO will have stalled waiting for words at the end of the last field.
+static void fifo_field_start(void)
+{
+	fifo_field.min_slack = UINT_MAX;
+	fifo_field.min_scanline = 0;
+	fifo_field.samples = 0;
+	fifo_field.total_slack = 0;
+	fifo_field.underruns = 0;
+	fifo_field.first_underrun = 0;
+	fifo_field.scanlines = 0;
+	VIDEO_PIO->fdebug = TXSTALL_BIT;
+}
+
+static __force_inline void fifo_check_underrun(unsigned scanline)
+{
+	if (VIDEO_PIO->fdebug & TXSTALL_BIT)
+	{
+		if (fifo_field.underruns++ == 0)
+			fifo_field.first_underrun = scanline;
+		VIDEO_PIO->fdebug = TXSTALL_BIT;
+	}
+}
+
+static __force_inline void fifo_sample(unsigned scanline)
+{
+	unsigned slack = fifo_slack(scanline);
+
+	fifo_field.samples++;
+	fifo_field.total_slack += slack;
+	if (slack < fifo_field.min_slack)
+	{
+		fifo_field.min_slack = slack;
+		fifo_field.min_scanline = scanline;
+	}
+	fifo_check_underrun(scanline);
+}
+
+// Nothing is queued after the last scanline or two to sample them, so
+// wait until the PIO has taken the final end-of-line marker and check for
+// an underrun once more.  It doesn't stall for the next field until the
+// next HSYNC, so this isn't counted as one.
+static void fifo_field_end(void)
+{
+#if DMA_OUTPUT
+	while (dma_channel_is_busy(line_dma[0]) || dma_channel_is_busy(line_dma[1]))
+		tight_loop_contents();
+#endif
+	while (!pio_sm_is_tx_fifo_empty(VIDEO_PIO, VIDEO_MODE7_SM))
+		tight_loop_contents();
+	fifo_check_underrun(fifo_field.scanlines);
+
+	fifo_stats_seq++;
+	__dmb();
+	fifo_stats.fields++;
+	fifo_stats.min_slack = fifo_field.min_slack;
+	fifo_stats.avg_slack = fifo_field.samples
+		? fifo_field.total_slack / fifo_field.samples : 0;
+	fifo_stats.min_scanline = fifo_field.min_scanline;
+	fifo_stats.underruns = fifo_field.underruns;
+	fifo_stats.first_underrun = fifo_field.first_underrun;
+	if ((fifo_stats.fields == 1)
+		|| (fifo_field.min_slack < fifo_stats.worst_slack))
+	{
+		fifo_stats.worst_slack = fifo_field.min_slack;
+		fifo_stats.worst_scanline = fifo_field.min_scanline;
+	}
+	fifo_stats.total_underruns += fifo_field.underruns;
+	if (fifo_field.underruns != 0) fifo_stats.underrun_fields++;
+	__dmb();
+	fifo_stats_seq++;
+}
+
+// Queue a scanline, sampling the slack first.  The first scanline of the
+// field follows the top border, so there's nothing to measure.
+static void __not_in_flash_func(queue_scanline)(unsigned scanline,
+	const uint32_t *words, unsigned count, bool last)
+{
+	if (scanline != 0) fifo_sample(scanline);
+	output_scanline(scanline, words, count, last);
+	fifo_field.scanlines = scanline + 1;
+}
+
+// Take a consistent copy of the FIFO statistics.
+// Can be called from either core.
+void mode7_get_fifo_stats(mode7_fifo_stats_t *stats)
+{
+	uint32_t seq;
 
-	font_mode = 0;
-	line = 0;
 	do
 	{
-		// Reset at start of line
-
-		// Colour state, formatted for sending to PIO with pixels added on.
-		// Foreground colour is in bits 8..14, background in bits 0..7,
-		// flag bit (always 1) in bit 15.
-		uint32_t colours = 0x8000 | (7 << 8) | 0;
-
-		font = font_list[0];
-		held_cell = font;	// First entry in font is space
-		dh_this_row = false;
-		flash = false;
-		conceal = false;
-		hold_gr = false;
-		// Reset font mode apart from BIT_2ND_ROW_DH
-		font_mode &= ~(BIT_DBL_HEIGHT | BIT_GRAPHICS | BIT_SEPARATED);
-
-		font = font_list[font_mode];
-
-		// Index the 40x25 buffer.  Note that we scan along each character line
-		// multiple times as we do the pixel rows, so we can't just keep
-		// incrementing chp from line to line.
-		chp = ttxt_buf + line * 40;
-
-		for (ch_pos = 0; ch_pos < 40; ch_pos++)
+		// Odd sequence number means an update is in progress
+		while ((seq = fifo_stats_seq) & 1)
+			tight_loop_contents();
+		__dmb();
+		*stats = fifo_stats;
+		__dmb();
+	} while (seq != fifo_stats_seq);
+}
+
+
+// Genlock.  The PIO waits for each HSYNC, so the start of every line is
+// locked to the Electron already, but the pixels along the line are timed
+// by the Pico's clock: if that runs fast or slow relative to the
+// Electron's crystal, the right of the picture moves.  So once a field
+// the line period is measured from the sync pulses still in sync_ring[]
+// (the 120 or so lines before the VSYNC), filtered, and the PIO clock
+// divider set to what comes nearest to making the line 40us by the
+// Electron's timing (with GENLOCK_SERVO; otherwise it's just measured).
+// The divider only has 8 bits of fraction, so steps of 0.1-0.4%, coarse
+// next to the error of a crystal.  It only changes when the next step is
+// closer by a margin, as hopping back and forth between two steps would
+// be worse than staying on either.  The statistics say how far out that
+// leaves the pixels.
+
+// Loop filter: each field moves the estimate of the line rate error
+// 1/(1 << GENLOCK_SHIFT) of the way to the measurement
+#define	GENLOCK_SHIFT		2
+// Fewest lines to take a measurement from
+#define	GENLOCK_MIN_LINES	32
+// Phase error at the end of the line that counts as locked, in ns (a
+// pixel is 83ns)
+#define	GENLOCK_LOCK_NS		10
+// How far the ideal divider has to be from the one in use before moving
+// to the nearest step, in 1/256ths of a step (so 128 is half way)
+#define	GENLOCK_THRESHOLD	160
+// Words after the head of the sync ring not to look at, as the DMA could
+// be writing them
+#define	SYNC_RING_GUARD		8
+
+static struct
+{
+	uint32_t sysclk_hz;
+	uint64_t div_nominal;		// Ideal divider for 64us lines, 16 bit fraction
+	uint32_t div;				// Divider in use, 8 bit fraction
+	int32_t rate;				// Filtered line rate error, ppb
+} genlock;
+
+// Written by core1 once a field under a sequence count, like the FIFO
+// statistics
+static mode7_genlock_stats_t genlock_stats;
+static volatile uint32_t genlock_stats_seq;
+
+static void genlock_init(uint32_t sysclk_hz, uint32_t div256)
+{
+	uint64_t pio_hz = pio_mhz * 1000000ull;
+
+	genlock.sysclk_hz = sysclk_hz;
+	genlock.div_nominal = (((uint64_t)sysclk_hz << 16) + pio_hz / 2) / pio_hz;
+	genlock.div = div256;
+	genlock.rate = 0;
+	genlock_stats.div_int = div256 >> 8;
+	genlock_stats.div_frac = div256 & 0xff;
+}
+
+// Measure the lines in the sync ring, from the falling edge of each HSYNC
+// to the next.  Only ordinary lines count, leaving out the VSYNC and any
+// equalising pulses.  Returns the number of lines, with their total length
+// in clk_sys cycles in *cycles.  Consecutive lines add up exactly, as
+// sync_measure accounts for every cycle.
+static unsigned genlock_measure(uint64_t *cycles)
+{
+	unsigned head = sync_ring_head() & ~1;
+	unsigned tail = (head + SYNC_RING_GUARD) & (SYNC_RING_WORDS - 1);
+	unsigned lines = 0;
+	uint32_t low, period;
+
+	*cycles = 0;
+	for (; tail != head; tail = (tail + 2) & (SYNC_RING_WORDS - 1))
+	{
+		low = 2 * ~sync_ring[tail] + 4;
+		period = low + 2 * ~sync_ring[tail + 1] + 4;
+		if ((low > SYNC_US(2)) && (low < SYNC_US(7))
+			&& (period > SYNC_US(63)) && (period < SYNC_US(65)))
 		{
-			ch = (*chp++) & 0x7f;
-			if (ch < 0x20)
-			{
-				// Only background changes and hold/release graphics
-				// take effect in the same cell as they occur - all others
-				// occur after rendering the cell.
-				switch (ch)
-				{
-					case 0x1c:		// Black background
-						colours = colours & ~7;	// Clear low 3 bits
-						break;
-	
-					case 0x1d:		// New background
-						// The new background colour is the current foreground,
-						// so copy down the bits
-						colours = (colours & ~7) | ((colours >> 8) & 7);
-						break;
-
-					case 0x1e:		// Hold graphics
-						hold_gr = true;
-						break;
-
-					case 0x1f:		// Release graphics	
-						hold_gr = false;
-						break;
-				}
-	
-				// Select the font cell for this character - normally space,
-				// unless hold graphics in effect
-				if ((font_mode & BIT_GRAPHICS) && hold_gr) fontp = held_cell;
-				else fontp = font_list[0];
-			}
-			else
-			{
-				// Not a control character - select the appropriate font cell
-				fontp = font + (ch - 0x20) * FONT_ROWS;
-			}
-	
-			// Consider recording this character as a possible future held
-			// graphic - only for graphic chars.
-			if ((font_mode & BIT_GRAPHICS)
-				&& (((ch >= 0x20) && (ch < 0x40)) || (ch > 0x60)))
-			{
-				held_cell = fontp;
-			}
+			*cycles += period;
+			lines++;
+		}
+	}
+	return lines;
+}
 
-			// In second row of double height, any normal height characters
-			// get replaced by spaces (1st cell of all fonts is space).
-			if (font_mode & (BIT_2ND_ROW_DH | BIT_DBL_HEIGHT)
-				== BIT_2ND_ROW_DH)
-			{
-				fontp = font_list[0];
-			}
+// Measure the line rate and, with GENLOCK_SERVO, update the divider.
+// Called once a field, during the top border, so a change is never in
+// the middle of the picture.
+static void genlock_update(void)
+{
+	uint64_t cycles, nominal;
+	unsigned lines = genlock_measure(&cycles);
+	int64_t ideal;
+#if GENLOCK_SERVO
+	int64_t diff;
+#endif
+	int32_t rate = 0;
+	int phase;
+	bool locked;
 
-			// If this character is flashing and the flash state is 'off'
-			// replace it with a blank.
-			// NB. spaces don't flash, but other
-			// control chars might do so due to hold graphics
-			if (flash && !flash_on) fontp = font_list[0];
+	if (lines >= GENLOCK_MIN_LINES)
+	{
+		// Error in ppb, with the nominal length scaled by 10^6
+		nominal = (uint64_t)lines * 64 * genlock.sysclk_hz;
+		rate = (int32_t)(((int64_t)(cycles * 1000000) - (int64_t)nominal)
+			* 1000 / (int64_t)(nominal / 1000000));
+		genlock.rate += (rate - genlock.rate) / (1 << GENLOCK_SHIFT);
+	}
 
-#ifdef CONCEAL_SUPPORT
-			// Replace concealed chars with spaces if enabled
-			if (conceal && enable_conceal) fontp = font_list[0];
+	// The PIO clock wants to be slower by the same proportion as the
+	// lines are longer.  Move to the nearest step if this is far enough
+	// from the one in use, but never below 1 (ie. faster than clk_sys).
+	ideal = (int64_t)genlock.div_nominal
+		+ (int64_t)genlock.div_nominal * genlock.rate / 1000000000;
+#if GENLOCK_SERVO
+	diff = ideal - ((int64_t)genlock.div << 8);
+	if ((diff > GENLOCK_THRESHOLD) || (diff < -GENLOCK_THRESHOLD))
+	{
+		uint32_t div = (ideal + 128) >> 8;
+
+		if (div < 0x100) div = 0x100;
+		if (div != genlock.div)
+		{
+			genlock.div = div;
+			pio_sm_set_clkdiv_int_frac(VIDEO_PIO, VIDEO_MODE7_SM, div >> 8,
+				div & 0xff);
+			genlock_stats.div_changes++;
+		}
+	}
 #endif
 
-			// Output the pixels of this character to the PIO
-			// Value written has the foreground/background colours,
-			// a flag bit, and the pixel data.
-			pio_sm_put_blocking(VIDEO_PIO, VIDEO_MODE7_SM,
-				colours | (fontp[row] << 16));
+	// Where the last pixel of the line ends up relative to where the
+	// Electron's timing would have it
+	phase = (int)((((int64_t)genlock.div << 8) - ideal) * 40000 / ideal);
+	locked = (lines >= GENLOCK_MIN_LINES) && (phase <= GENLOCK_LOCK_NS)
+		&& (phase >= -GENLOCK_LOCK_NS);
+
+	genlock_stats_seq++;
+	__dmb();
+	genlock_stats.fields++;
+	genlock_stats.lines = lines;
+	genlock_stats.rate_error = rate;
+	genlock_stats.rate_filtered = genlock.rate;
+	genlock_stats.phase_error = phase;
+	if (genlock_stats.locked && !locked) genlock_stats.lock_losses++;
+	if (locked && (abs(phase) > abs(genlock_stats.worst_phase)))
+		genlock_stats.worst_phase = phase;
+	genlock_stats.locked = locked;
+	genlock_stats.div_int = genlock.div >> 8;
+	genlock_stats.div_frac = genlock.div & 0xff;
+	__dmb();
+	genlock_stats_seq++;
+}
 
+// Take a consistent copy of the genlock statistics.
+// Can be called from either core.
+void mode7_get_genlock_stats(mode7_genlock_stats_t *stats)
+{
+	uint32_t seq;
 
-			// Most of the control characters take effect after the cell
-			if (ch < 0x20)
-			{
-				switch (ch)
-				{
-					case 0x01:		// Alpha red
-					case 0x02:		// Alpha green
-					case 0x03:		// Alpha yellow
-					case 0x04:		// Alpha blue
-					case 0x05:		// Alpha magenta
-					case 0x06:		// Alpha cyan
-					case 0x07:		// Alpha white
-						// Change the foreground colour (in bits 8..10)
-						// to the value of the control character.
-						colours = (colours & ~0x700) | (ch << 8);
-						font_mode &= ~BIT_GRAPHICS;
-						// Change of text/graphics mode cancels hold graphic
-						held_cell = font;
-						break;
-
-					case 0x08:		// Flash
-						flash = true;
-						break;
-
-					case 0x09:		// Steady
-						flash = false;
-						break;
-
-					case 0x0c:		// Normal height
-						font_mode &= ~BIT_DBL_HEIGHT;
-						// Change of double-height mode cancels hold graphic
-						held_cell = font;
-						break;
-
-					case 0x0d:		// Double height
-						font_mode |= BIT_DBL_HEIGHT;
-						dh_this_row = true;
-						// Change of double-height mode cancels hold graphic
-						held_cell = font;
-						break;
-
-					case 0x11:		// Mosaic red
-					case 0x12:		// Mosaic green
-					case 0x13:		// Mosaic yellow
-					case 0x14:		// Mosaic blue
-					case 0x15:		// Mosaic magenta
-					case 0x16:		// Mosaic cyan	
-					case 0x17:		// Mosaic white	
-						// Change the foreground colour (in bits 8..10)
-						// to the value of the low bits of the ctrl character.
-						colours = (colours & ~0x700) | ((ch & 7) << 8);
-						font_mode |= BIT_GRAPHICS;
-						// Change of text/graphics mode cancels hold graphic
-						held_cell = font;
-						break;
-
-					case 0x18:		// Conceal
-						conceal = true;
-						break;
-
-					case 0x19:		// Contiguous graphics
-						font_mode &= ~BIT_SEPARATED;
-						break;
-
-					case 0x1a:		// Separated graphics
-						font_mode |= BIT_SEPARATED;
-						break;
+	do
+	{
+		// Odd sequence number means an update is in progress
+		while ((seq = genlock_stats_seq) & 1)
+			tight_loop_contents();
+		__dmb();
+		*stats = genlock_stats;
+		__dmb();
+	} while (seq != genlock_stats_seq);
+}
 
-				}
 
-				// Choose appropriate font resulting from change (if any)
-				font = font_list[font_mode];
+#if RENDER_ON_CORE0
+
+// Handoff between the cores when core0 is rendering.  At the start of
+// each field core1 fills in the request and bumps render_field_seq; core0
+// then renders the lines into the line cache, which serves as the line
+// buffers, bumping lines_ready as each one is finished.  core1 only ever
+// reads lines below lines_ready, and core0 doesn't touch any line again
+// until core1 has finished the field and asked for the next one, so the
+// two indices are all the synchronisation needed.
+// core1 rings core0 through the inter-core FIFO, whose interrupt on core0
+// does the rendering at the highest priority, so nothing core0 is doing
+// in its main loop (eg. printing over USB) can hold it up.
+static mode7_page_t render_page;
+static bool render_flash_on;
+static unsigned render_first_row;
+static volatile uint32_t render_field_seq;
+static volatile unsigned lines_ready;
+
+static void __not_in_flash_func(line_ready)(unsigned line)
+{
+	lines_ready = line + 1;
+}
 
-			}
+// Renders the lines of a field on core0 as soon as core1 has asked for
+// it.  The FIFO words are just a doorbell: the request is in the
+// variables above.
+static void __not_in_flash_func(render_irq)(void)
+{
+	static uint32_t done_seq = 0;
+
+	while (multicore_fifo_rvalid())
+		(void)sio_hw->fifo_rd;
+	multicore_fifo_clear_irq();
+	if (render_field_seq == done_seq) return;
+	done_seq = render_field_seq;
+	__dmb();
+	mode7_render_field(mode7_page_snapshot(&render_page), render_flash_on,
+		render_first_row, NULL, line_ready);
+}
+
+// Called on core0 once core1 has been launched (as the launch uses the
+// FIFO too), to take the fields core1 hands over.  Each field is rendered
+// in one go at the highest priority, so the USB stdio interrupts on this
+// core are held off until it's done: for most of the field when many
+// lines have changed, which makes the console that much slower to respond.
+void mode7_render_start(void)
+{
+	// This core's SysTick is needed for the timing statistics
+	mode7_render_core_init();
+	multicore_fifo_clear_irq();
+	irq_set_exclusive_handler(SIO_IRQ_PROC0, render_irq);
+	irq_set_priority(SIO_IRQ_PROC0, PICO_HIGHEST_IRQ_PRIORITY);
+	irq_set_enabled(SIO_IRQ_PROC0, true);
+}
+
+#else
+
+void mode7_render_start(void)
+{
+}
+
+#endif
+
+
+// Generate one field of teletext display, with the PIO program handling
+// HSYNC timing and the expansion of 12 horizontal pixels.  The page can
+// be scrolled by just changing its start, or put together from lines in
+// different buffers (see mode7_page_t).
+// This waits for VSYNC before starting, measures the relative HSYNC/VSYNC
+// timing to determine whether it is the odd or even field, and exits
+// after the last visible line.  Hence it should be called in a loop
+// to produce a continuous display, with the caller having a little time
+// to do some housekeeping between calls and still get there in time for
+// the next VSYNC.
+// With RENDER_ON_CORE0, the rendering itself is done by an interrupt on
+// core0 (see mode7_render_start()), which gets the field handed over to
+// it as soon as the VSYNC has been seen, leaving this core with just the
+// output to do.
+void __not_in_flash_func(mode7_display_field)(const mode7_page_t *page,
+	bool flash_on)
+{
+	unsigned first_row;		// First row of each line in this field (0/1)
+#if RENDER_ON_CORE0
+	unsigned line, row, scanline, count;
+#else
+	// Copy the page while there's nothing else to do
+	page = mode7_page_snapshot(page);
+#endif
+
+	// Start on row 0 or 1 depending on whether this is odd or even field
+	if (wait_for_vsync()) first_row = 0;
+	else first_row = 1;
+	fifo_field_start();
+	genlock_update();
+
+#if RENDER_ON_CORE0
+	// Hand the field over to core0.  There's the top border (VERTICAL_POS
+	// lines) still to go before the first line is needed.
+	render_page = *page;
+	render_flash_on = flash_on;
+	render_first_row = first_row;
+	lines_ready = 0;
+	__dmb();
+	render_field_seq++;
+	if (multicore_fifo_wready()) sio_hw->fifo_wr = render_field_seq;
+#endif
+
+#if DMA_OUTPUT
+	line_dma_start_field();
+#endif
+
+#if RENDER_ON_CORE0
+	scanline = 0;
+	for (line = 0; line < 25; line++)
+	{
+		// Wait for core0 to get this line done
+		if (lines_ready <= line)
+		{
+			mode7_count_render_stall();
+			while (lines_ready <= line)
+				tight_loop_contents();
 		}
+		__dmb();
+
+		for (row = first_row; row < ROWS_PER_LINE; row += 2)
+		{
+			const uint32_t *words = mode7_line_words(line, row, &count);
 
-		// End-of row processing
+			queue_scanline(scanline, words, count,
+				(line == 24) && (row + 2 >= ROWS_PER_LINE));
+			scanline++;
+		}
+	}
+#else
+	mode7_render_field(page, flash_on, first_row, queue_scanline, NULL);
+#endif
+	fifo_field_end();
+}
 
-		// Tell the PIO to wait for HSYNC before the next row
-		// This has the low 16 bits clear to distinguish it from normal
-		// pixel data, and has the back-porch delay in the high bits.
-		pio_sm_put_blocking(VIDEO_PIO, VIDEO_MODE7_SM, BACK_PORCH << 16);
 
-		row += 2;		// Interlaced display, so step on by two rows
+// Pick the PIO clock for a system clock of sysclk_hz: of the multiples
+// of 12MHz the program can do (at least 8 cycles per pixel, and no more
+// than the back porch count allows), the one the divider gets closest
+// to.  Returns the clock in MHz, or 0 if the system clock is too slow,
+// with the divider in 1/256ths.  A whole-number divider is exact, and
+// otherwise the PIO skips the odd cycle of clk_sys, which moves some of
+// the pixel edges by one clk_sys cycle.
+static unsigned pick_pio_clock(uint32_t sysclk_hz, uint32_t *div256)
+{
+	uint64_t sysclk256 = (uint64_t)sysclk_hz << 8;
+	uint64_t best_err = UINT64_MAX;
+	unsigned best = 0;
 
-		// If there's another row in the same line, just go round and do
-		// it all again to get the next row out of the font and the
-		// same characters.  Else step on to next line.
-		if (row >= ROWS_PER_LINE)
+	for (unsigned mhz = 12 * 8; mhz <= MODE7_MAX_PIO_MHZ; mhz += 12)
+	{
+		uint64_t pio_hz = mhz * 1000000ull;
+		uint64_t div, err;
+
+		if (pio_hz > sysclk_hz) break;
+		div = (sysclk256 + pio_hz / 2) / pio_hz;
+		err = div * pio_hz;
+		err = (err > sysclk256) ? err - sysclk256 : sysclk256 - err;
+		// On a tie, the faster clock moves the edges by less
+		if (err <= best_err)
 		{
-			row -= ROWS_PER_LINE;
-			line++;
-
-			// Fix up for double height.  If we were doing a proper display,
-			// we'd repeat the previous line; however, this is emulating
-			// a BBC micro that requires the user to fill in the 2nd line
-			// so we just set the flags that will cause us to select the
-			// lower-half font next time round.
-			if (font_mode & BIT_2ND_ROW_DH)
-			{
-				font_mode &= ~BIT_2ND_ROW_DH;
-			}
-			else if (dh_this_row)
-			{
-				font_mode |= BIT_2ND_ROW_DH;
-			}
+			best_err = err;
+			best = mhz;
+			*div256 = div;
 		}
-	} while (line < 25);
+	}
+	return best;
 }
 
+// Load the mode7_output program with the pixel delays patched for the
+// PIO clock (see mode7.pio).  It has to go at offset 0, which
+// pio_add_program() insists on.
+static unsigned load_mode7_output(unsigned mhz)
+{
+	uint16_t code[count_of(mode7_output_program_instructions)];
+	pio_program_t prog = mode7_output_program;
+	const unsigned patch[] = {
+		mode7_output_offset_do_out, mode7_output_offset_bkgnd
+	};
+
+	memcpy(code, mode7_output_program_instructions, sizeof(code));
+	for (unsigned u = 0; u < count_of(patch); u++)
+	{
+		code[patch[u]] = (code[patch[u]] & ~pio_encode_delay(31))
+			| pio_encode_delay(mhz / 12 - 8);
+	}
+	prog.instructions = code;
+	return pio_add_program(VIDEO_PIO, &prog);
+}
 
-// Initialise PIO etc. ready to call mode7_display_field()
-void mode7_init(void)
+// Initialise PIO etc. ready to call mode7_display_field(), for a system
+// clock of sysclk_hz (at least 96MHz).
+void mode7_init(uint32_t sysclk_hz)
 {
 	unsigned offset;
+	uint32_t div256;
+
+	pio_mhz = pick_pio_clock(sysclk_hz, &div256);
+	if (pio_mhz == 0) panic("mode7: %uHz is too slow", (unsigned)sysclk_hz);
+	sync_mhz = (sysclk_hz + 500000) / 1000000;
+	eol_word = MODE7_EOL(pio_mhz);
 
-	// Load the PIO program
-	offset = pio_add_program(VIDEO_PIO, &mode7_output_program);
+	mode7_render_init(pio_mhz);
 
-	// Initialise and start the PIO state machine
-	mode7_output_init(VIDEO_PIO, VIDEO_MODE7_SM, offset);
+	// Load the PIO program, and initialise and start the state machine
+	offset = load_mode7_output(pio_mhz);
+	mode7_output_init(VIDEO_PIO, VIDEO_MODE7_SM, offset, div256 >> 8,
+		div256 & 0xff);
+	genlock_init(sysclk_hz, div256);
+
+#if DMA_OUTPUT
+	line_dma_init();
+#endif
+
+	// Sync measurement, for wait_for_vsync() on this core
+	sync_measure_start();
+
+#if !RENDER_ON_CORE0
+	// Called on the rendering core, so that's the SysTick we get.  With
+	// RENDER_ON_CORE0, mode7_render_start() does it on core0.
+	mode7_render_core_init();
+#endif
 
 	// PIO will be blocked waiting for something in the FIFO before
 	// it does anything.  Feed it an end-of-line, which will force
 	// the outputs to black while it waits for the HSYNC (it will then
 	// get blocked again until we get around to starting up properly).
-	pio_sm_put_blocking(VIDEO_PIO, VIDEO_MODE7_SM, BACK_PORCH << 16);
+	pio_sm_put_blocking(VIDEO_PIO, VIDEO_MODE7_SM, eol_word);
 
 	// Now safe to enable the outputs
 	gpio_put(PIN_RGB_EN, 1);			// Active low enable on the passthrough
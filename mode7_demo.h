@@ -2,31 +2,72 @@
 #include <stdbool.h>
 #include "pico/stdlib.h"
 #include "hardware/pio.h"
+#include "mode7_render.h"
 
 // Which PIO to use.  This should be in a board definition file.
 #define	VIDEO_PIO			pio1
 #define	VIDEO_MODE7_SM		0
 #define	VIDEO_SYNCGEN_SM	3
+// Sync measurement and bus capture are on the other PIO, as there's no
+// room on the video one
+#define	SYNC_PIO			pio0
+#define	SYNC_PIO_IRQ		PIO0_IRQ_0
+#define	SYNC_MEASURE_SM		0
+#define	BUS_CAPTURE_SM		1
 
 
-// test_pages.c
-#define NOOF_TEST_PAGES 4
-extern const uint8_t * const test_pages[NOOF_TEST_PAGES];
+// mode7.c
+// FIFO slack statistics: words queued for the PIO at the end of each
+// scanline, and underruns where it ran out.  Per-field values are for the
+// last field.
+typedef struct
+{
+	unsigned fields;			// Fields displayed so far
+	unsigned min_slack;			// Fewest words queued
+	unsigned avg_slack;			// Average words queued
+	unsigned min_scanline;		// Scanline of the field with the fewest
+	unsigned underruns;			// Scanlines where the PIO ran out of words
+	unsigned first_underrun;	// First scanline that did
+	unsigned worst_slack;		// Fewest words queued in any field
+	unsigned worst_scanline;	// ... and where
+	unsigned total_underruns;	// Running total of underruns
+	unsigned underrun_fields;	// Fields with underruns
+} mode7_fifo_stats_t;
 
-// fonts.c
-extern const uint16_t font_std[96*20];
-extern const uint16_t font_std_dh_upper[96*20];
-extern const uint16_t font_std_dh_lower[96*20];
-extern const uint16_t font_graphic[96*20];
-extern const uint16_t font_graphic_dh_upper[96*20];
-extern const uint16_t font_graphic_dh_lower[96*20];
-extern const uint16_t font_sep_graphic[96*20];
-extern const uint16_t font_sep_graphic_dh_upper[96*20];
-extern const uint16_t font_sep_graphic_dh_lower[96*20];
+// Genlock statistics: how the Electron's line rate compares with the
+// Pico's clock, and how far out the PIO clock divider leaves the pixels.
+// Rates are in parts per billion, positive when the Electron's lines are
+// longer than 64us by the Pico's clock.
+typedef struct
+{
+	unsigned fields;			// Fields measured
+	unsigned lines;				// Lines measured for the last field
+	int rate_error;				// Line rate error measured last field
+	int rate_filtered;			// ... and as filtered by the loop
+	int phase_error;			// Last pixel of the line late by, in ns
+	int worst_phase;			// Largest phase error while locked
+	bool locked;				// Phase error within GENLOCK_LOCK_NS
+	unsigned lock_losses;		// Times it has gone out of lock
+	unsigned div_int, div_frac;	// PIO clock divider in use
+	unsigned div_changes;		// Times the loop has changed it
+} mode7_genlock_stats_t;
 
-// mode7.c
-extern void mode7_display_field(const uint8_t *ttxt_buf, bool flash_on);
-extern void mode7_init(void);
+extern void mode7_display_field(const mode7_page_t *page, bool flash_on);
+extern void mode7_init(uint32_t sysclk_hz);
+extern void mode7_render_start(void);
+extern void mode7_get_fifo_stats(mode7_fifo_stats_t *stats);
+extern void mode7_get_genlock_stats(mode7_genlock_stats_t *stats);
 
 // makesyncs.c
+// Number of sync pulses in a frame: 620 HSYNCs plus the two VSYNCs.
+// A table for the sync generator has a word for each, with the time the
+// sync is low in bits 0-15 and then high in bits 16-31, each in cycles of
+// the system clock less 2.
+#define	SYNC_FRAME_PULSES	622
 extern void syncgen_start(void);
+extern void syncgen_make_frame(uint32_t *table, unsigned mhz);
+extern void syncgen_set_table(const uint32_t *table);
+
+// buscapture.c
+extern const uint8_t *buscapture_start(void);
+extern bool buscapture_overrun(void);
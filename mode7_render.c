@@ -0,0 +1,1021 @@
+
+#include "mode7_render.h"
+
+#include <string.h>
+
+#ifdef MODE7_HOST
+#include <time.h>
+#if DECODE_USE_INTERP
+#include "mock_interp.h"
+#endif
+#else
+#if DECODE_USE_INTERP
+#include "hardware/interp.h"
+#endif
+#include "hardware/regs/addressmap.h"
+#include "hardware/structs/systick.h"
+#endif
+
+#if RENDER_DATA_IN_SRAM
+#if RENDER_ON_CORE0
+#define	__render_bank(group)	__scratch_y(group)
+#else
+#define	__render_bank(group)	__scratch_x(group)
+#endif
+
+// Copy of font_std, filled in by mode7_init().  At 3840 bytes it won't
+// fit alongside a stack in a 4K scratch bank, so it goes in the striped
+// main SRAM.
+static uint16_t render_font[96 * FONT_ROWS];
+
+// A page in flash is copied here each field before rendering
+static uint8_t __render_bank("mode7_page") page_buf[PAGE_BYTES]
+	__attribute__((aligned(4)));
+static mode7_page_t __render_bank("mode7_page") page_snapshot =
+	{ page_buf, 0, PAGE_WINDOW - 1, 40, 0, NULL };
+
+// A table of lines with some in flash is given in place of the table: the
+// lines in flash are copied to their places in page_buf.
+static const uint8_t *__render_bank("mode7_page") lines_snapshot[25];
+static mode7_page_t __render_bank("mode7_page") lines_page =
+	{ page_buf, 0, PAGE_WINDOW - 1, 40, 0, lines_snapshot };
+
+// Whether the renderer would be reading p from XIP flash, through any of
+// its aliases.  Nothing is on a PC.
+#ifdef MODE7_HOST
+#define	in_xip_flash(p)		false
+#else
+static __force_inline bool in_xip_flash(const void *p)
+{
+	return ((uintptr_t)p >= XIP_BASE) && ((uintptr_t)p < XIP_CTRL_BASE);
+}
+#endif
+#else
+#define	__render_bank(group)
+#define	render_font		font_std
+#endif
+
+
+
+/* Decoder state, all packed into one word so that control codes can be
+   applied as a pair of masks:
+   bits 0..2  - background colour
+   bit 3      - graphics
+   bit 4      - double height
+   bit 5      - 2nd row of double height
+   bit 6      - separated graphics (same bit as MOSAIC_SEPARATED)
+   bit 7      - hold graphics
+   bits 8..10 - foreground colour
+   bit 11     - flash
+   bit 12     - conceal
+   bit 13     - line has a double height code (LINE_DBL_HEIGHT)
+   bit 14     - line has a flash code (LINE_FLASHING)
+   bit 15     - unused
+   bits 16..23 - held mosaic (MOSAIC_xxx value)
+   The colours for the PIO are shifted into place by CELL_COLOURS().
+   Only the alphanumeric font is stored.  Double height is done by
+   mapping the scanline onto the rows of the upper or lower half of the
+   glyph when rendering, selected by the cell's dh_half, and the mosaic
+   characters are generated from their sextant bits.
+*/
+#define	STATE_BG			0x00000007
+#define	STATE_GRAPHICS		0x00000008
+#define	STATE_DBL_HEIGHT	0x00000010
+#define	STATE_2ND_ROW_DH	0x00000020
+#define	STATE_SEPARATED		0x00000040
+#define	STATE_HOLD			0x00000080
+#define	STATE_FG			0x00000700
+#define	STATE_FLASH			0x00000800
+#define	STATE_CONCEAL		0x00001000
+#define	STATE_SEEN_DH		0x00002000
+#define	STATE_SEEN_FLASH	0x00004000
+#define	STATE_HELD_SHIFT	16
+#define	STATE_HELD			(0xff << STATE_HELD_SHIFT)
+
+// State at the start of each line
+#define	STATE_RESET			((7 << 8) | (MOSAIC_BLANK << STATE_HELD_SHIFT))
+
+// A PIO cell word with the colours from the state, ready for the pixels
+#define	CELL_COLOURS(state)	\
+	MODE7_CELL((state) & STATE_BG, ((state) & STATE_FG) >> 8, 0)
+
+// Which half of the glyph to show, indexed by the double height bits
+// of the state.
+#define	DH_NONE			0
+#define	DH_UPPER		1
+#define	DH_LOWER		2
+static const uint8_t __render_bank("mode7_tables") dh_half_list[4] = {
+	DH_NONE,
+	DH_UPPER,
+	DH_NONE,                     /* 2nd row, but this char not double    */
+	DH_LOWER
+};
+
+// Mosaic cells are described by the sextant bits of the character,
+// which are bits 0..4 and 6 of the character code:
+//    0 1
+//    2 3
+//    4 5
+// plus whether separated graphics applies, and a flag to say it's a
+// mosaic (so that a blank mosaic is non-zero).
+#define	MOSAIC_CELL			0x80
+#define	MOSAIC_SEPARATED	STATE_SEPARATED
+#define	MOSAIC_BLANK		MOSAIC_CELL
+
+// Shift to bring the pair of sextant bits for each glyph row down to
+// the bottom.  Blocks are 6, 6 and 8 rows high (7 and 7 on the SAA5050,
+// but the font only has 19 real rows of which the 20th is a repeat).
+static const uint8_t __render_bank("mode7_tables") mosaic_shift[FONT_ROWS] = {
+	0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2,
+	4, 4, 4, 4, 4, 4, 4, 4
+};
+
+// Pixels for each combination of the left and right sextants of a row.
+static const uint16_t __render_bank("mode7_tables") mosaic_pair[4] = {
+	0x000, 0x03f, 0xfc0, 0xfff
+};
+
+// Mask applied to the pair for each glyph row: all pixels for contiguous
+// graphics, while separated graphics loses the rightmost column of each
+// block and the last row of each block.
+#define	MOSAIC_SEP_COLS	(0x01f | 0x7c0)
+static const uint16_t __render_bank("mode7_tables")
+	mosaic_mask[2][FONT_ROWS] = {
+	{
+		0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff,
+		0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff,
+		0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff, 0xfff
+	},
+	{
+		MOSAIC_SEP_COLS, MOSAIC_SEP_COLS, MOSAIC_SEP_COLS,
+		MOSAIC_SEP_COLS, MOSAIC_SEP_COLS, 0,
+		MOSAIC_SEP_COLS, MOSAIC_SEP_COLS, MOSAIC_SEP_COLS,
+		MOSAIC_SEP_COLS, MOSAIC_SEP_COLS, 0,
+		MOSAIC_SEP_COLS, MOSAIC_SEP_COLS, MOSAIC_SEP_COLS,
+		MOSAIC_SEP_COLS, MOSAIC_SEP_COLS, MOSAIC_SEP_COLS, 0, 0
+	}
+};
+
+// Pixels of one glyph row of a mosaic cell
+static __force_inline unsigned mosaic_row(uint32_t mosaic, unsigned grow)
+{
+	return mosaic_pair[(mosaic >> mosaic_shift[grow]) & 3]
+		& mosaic_mask[(mosaic & MOSAIC_SEPARATED) != 0][grow];
+}
+
+// Decoded form of one character cell.  A character line is decoded once
+// per field by decode_line(), and the resulting array of cells is then
+// used for each of the pixel rows of that line, so the serial-attribute
+// processing isn't repeated for every row.
+typedef struct
+{
+	// Start of the glyph for this cell within the font, already resolved
+	// for flash etc.  Only used if mosaic is zero.
+	const uint16_t *fontp;
+
+	// MOSAIC_xxx and the sextant bits if this is a mosaic cell, already
+	// resolved for hold graphics etc.  Zero for an alphanumeric cell.
+	uint32_t mosaic;
+
+	// Colour state, formatted as a PIO cell word for the pixels to be
+	// added on to.
+	uint32_t colours;
+
+	// DH_xxx: which rows of the glyph make up this line.
+	uint32_t dh_half;
+} cell_t;
+
+
+#if DECODE_USE_INTERP
+
+// INTERP0 on the decoding core is set up so that writing a character byte,
+// shifted up by 8, to ACCUM0 gives the address of its glyph in the FULL
+// result: lane 0 contributes ch * 32 bytes and lane 1 (crossed over to
+// read ACCUM0 as well) ch * 8, making the ch * FONT_ROWS * 2 offset, and
+// BASE2 holds the base of the font less the 0x20 it starts at.
+// The masks also drop bit 7 of the character for free.
+static __force_inline void glyph_interp_init(void)
+{
+	interp_config cfg;
+
+	cfg = interp_default_config();
+	interp_config_set_shift(&cfg, 8 - 5);
+	interp_config_set_mask(&cfg, 5, 11);
+	interp_set_config(interp0, 0, &cfg);
+
+	cfg = interp_default_config();
+	interp_config_set_cross_input(&cfg, true);
+	interp_config_set_shift(&cfg, 8 - 3);
+	interp_config_set_mask(&cfg, 3, 9);
+	interp_set_config(interp0, 1, &cfg);
+
+	interp_set_base(interp0, 0, 0);
+	interp_set_base(interp0, 1, 0);
+	interp_set_base(interp0, 2,
+		(uintptr_t)render_font - 0x20 * FONT_ROWS * sizeof(uint16_t));
+}
+
+#endif
+
+// Flags returned by decode_line() describing the line
+#define	LINE_DBL_HEIGHT	1	// Has a double-height code in it
+#define	LINE_FLASHING	2	// Has flashing cells, so depends on flash phase
+
+// What each control code does to the decoder state.  Only background
+// changes and hold/release graphics take effect in the same cell as they
+// occur ("set-at"), and only touch the low byte of the state - all others
+// occur after the cell ("set-after").  Set-at also has a mask of the
+// foreground bits to copy down into the background, for New Background.
+// Entry 0 does nothing, and is used for the printable characters too so
+// that every cell goes through the same steps.
+typedef struct
+{
+	uint32_t after_clear, after_set;
+	uint8_t at_clear, at_set, at_copy;
+} ctrl_action_t;
+
+#define	SET_AT(clear, set, copy)	\
+	{ .at_clear = (clear), .at_set = (set), .at_copy = (copy) }
+#define	SET_AFTER(clear, set)	\
+	{ .after_clear = (clear), .after_set = (set) }
+// Change of text/graphics or double-height mode cancels hold graphic
+#define	SET_AFTER_HELD(clear, set)	\
+	{ .after_clear = (clear) | STATE_HELD,	\
+	  .after_set = (set) | (MOSAIC_BLANK << STATE_HELD_SHIFT) }
+#define	ALPHA(colour)	\
+	SET_AFTER_HELD(STATE_FG | STATE_GRAPHICS, (colour) << 8)
+#define	MOSAIC(colour)	\
+	SET_AFTER_HELD(STATE_FG, ((colour) << 8) | STATE_GRAPHICS)
+
+static const ctrl_action_t __render_bank("mode7_tables") ctrl_actions[32] = {
+	[0x01] = ALPHA(1),				// Alpha red
+	[0x02] = ALPHA(2),				// Alpha green
+	[0x03] = ALPHA(3),				// Alpha yellow
+	[0x04] = ALPHA(4),				// Alpha blue
+	[0x05] = ALPHA(5),				// Alpha magenta
+	[0x06] = ALPHA(6),				// Alpha cyan
+	[0x07] = ALPHA(7),				// Alpha white
+	[0x08] = SET_AFTER(0, STATE_FLASH | STATE_SEEN_FLASH),	// Flash
+	[0x09] = SET_AFTER(STATE_FLASH, 0),						// Steady
+	[0x0c] = SET_AFTER_HELD(STATE_DBL_HEIGHT, 0),			// Normal height
+	[0x0d] = SET_AFTER_HELD(0, STATE_DBL_HEIGHT | STATE_SEEN_DH),	// Double
+	[0x11] = MOSAIC(1),				// Mosaic red
+	[0x12] = MOSAIC(2),				// Mosaic green
+	[0x13] = MOSAIC(3),				// Mosaic yellow
+	[0x14] = MOSAIC(4),				// Mosaic blue
+	[0x15] = MOSAIC(5),				// Mosaic magenta
+	[0x16] = MOSAIC(6),				// Mosaic cyan
+	[0x17] = MOSAIC(7),				// Mosaic white
+	[0x18] = SET_AFTER(0, STATE_CONCEAL),					// Conceal
+	[0x19] = SET_AFTER(STATE_SEPARATED, 0),					// Contiguous
+	[0x1a] = SET_AFTER(0, STATE_SEPARATED),					// Separated
+	// Black background
+	[0x1c] = SET_AT(STATE_BG, 0, 0),
+	// New background: the new background colour is the current
+	// foreground, so copy down the bits
+	[0x1d] = SET_AT(STATE_BG, 0, STATE_BG),
+	[0x1e] = SET_AT(0, STATE_HOLD, 0),		// Hold graphics
+	[0x1f] = SET_AT(STATE_HOLD, 0, 0)		// Release graphics
+};
+
+// Decode one 40-character line into cells[].
+// entry is the state at the start of the line: STATE_RESET, or what's
+// left from the characters to the left of a view (see prescan_line()),
+// plus STATE_2ND_ROW_DH if this line is the 2nd row of a double-height
+// line (ie. the previous line had a double-height code in it).
+// hide is the state bits (STATE_FLASH and/or STATE_CONCEAL) which cause
+// a cell to be displayed as a space: it's a constant in each of the
+// specialised kernels below, so the test costs the same whatever it is.
+// Returns LINE_xxx flags.
+// Every cell goes through the control code table, but the time per cell
+// isn't constant: control codes, mosaics and alphanumerics each take
+// their own branch to choose the glyph, as do the rows of the cells in
+// render_scanline().  So the worst case is only as measured, by the 'S'
+// command's per line decode figure and by mode7_bench's worst-case pages,
+// rather than a bound that can be worked out from the code.
+static __force_inline unsigned decode_line_kernel(const uint8_t *chp,
+	uint32_t entry, cell_t *cells, const uint32_t hide)
+{
+	unsigned ch_pos;		// Which character within the line (0..39)
+
+	// Character value retrieved from *chp
+	unsigned ch;
+
+	// Packed decoder state, STATE_xxx
+	uint32_t state;
+
+	// Control code actions for this character
+	const ctrl_action_t *action;
+
+	// fontp is the current character within the font, used only
+	// momentarily.  The font starts at character value 0x20 and contains
+	// 96 characters, formatted as one row of pixels per 16-bit word.
+	const uint16_t *fontp;
+
+	// mosaic is the MOSAIC_xxx value for the current character, or zero
+	// if it's to be taken from the font.  The held mosaic in Hold
+	// Graphics mode is kept in the state: it can be held from some time
+	// before the HG control code appears on the line, so is distinct from
+	// the STATE_HOLD flag that tells us whether or not to use it.
+	uint32_t mosaic;
+
+	state = entry;
+	fontp = render_font;
+
+#if DECODE_USE_INTERP
+	// The interpolators are per-core, so set up each time in case
+	// we're not on the same core as last time.
+	glyph_interp_init();
+#endif
+
+	for (ch_pos = 0; ch_pos < 40; ch_pos++)
+	{
+#if DECODE_USE_INTERP
+		interp_set_accumulator(interp0, 0, *chp << 8);
+#endif
+		ch = (*chp++) & 0x7f;
+		action = &ctrl_actions[(ch < 0x20) ? ch : 0];
+
+		// Set-at changes
+		state = (state & ~(uint32_t)action->at_clear) | action->at_set
+			| ((state >> 8) & action->at_copy);
+
+		if (ch < 0x20)
+		{
+			// Control character - normally space, unless hold graphics
+			// in effect
+			if ((state & (STATE_GRAPHICS | STATE_HOLD))
+				== (STATE_GRAPHICS | STATE_HOLD))
+				mosaic = (state >> STATE_HELD_SHIFT) & 0xff;
+			else mosaic = MOSAIC_BLANK;
+		}
+		else if ((state & STATE_GRAPHICS) && (ch & 0x20))
+		{
+			// Mosaic character (0x20..0x3f, 0x60..0x7f): collect the
+			// sextant bits, and take separated mode from the state.
+			mosaic = MOSAIC_CELL | (ch & 0x1f) | ((ch & 0x40) >> 1)
+				| (state & STATE_SEPARATED);
+
+			// Record this as a possible future held graphic
+			if (ch != 0x60)
+			{
+				state = (state & ~STATE_HELD)
+					| (mosaic << STATE_HELD_SHIFT);
+			}
+		}
+		else
+		{
+			// Not a control character - select the appropriate font cell
+#if DECODE_USE_INTERP
+			fontp = (const uint16_t *)(uintptr_t)
+				interp_peek_full_result(interp0);
+#else
+			fontp = render_font + (ch - 0x20) * FONT_ROWS;
+#endif
+			mosaic = 0;
+		}
+
+		// If this character is flashing and the flash state is 'off'
+		// (or concealed and being hidden) replace it with a blank.
+		// NB. spaces don't flash, but other
+		// control chars might do so due to hold graphics
+		if (state & hide) mosaic = MOSAIC_BLANK;
+
+		// Record the resolved cell: the row loop in mode7_render_field()
+		// adds the pixels for each row to the colours.
+		cells[ch_pos].fontp = fontp;
+		cells[ch_pos].mosaic = mosaic;
+		cells[ch_pos].colours = CELL_COLOURS(state);
+		cells[ch_pos].dh_half = dh_half_list[(state / STATE_DBL_HEIGHT) & 3];
+
+		// Set-after changes
+		state = (state & ~action->after_clear) | action->after_set;
+	}
+	return ((state & STATE_SEEN_DH) ? LINE_DBL_HEIGHT : 0)
+		| ((state & STATE_SEEN_FLASH) ? LINE_FLASHING : 0);
+}
+
+// The decoder specialised for each combination of flash phase and
+// whether concealed text is hidden.
+#define	DECODE_KERNEL(name, hide)	\
+	static unsigned __not_in_flash_func(name)(const uint8_t *chp,	\
+		uint32_t entry, cell_t *cells)	\
+	{	\
+		return decode_line_kernel(chp, entry, cells, (hide));	\
+	}
+
+DECODE_KERNEL(decode_flash_on, 0)
+DECODE_KERNEL(decode_flash_off, STATE_FLASH)
+DECODE_KERNEL(decode_flash_on_conceal, STATE_CONCEAL)
+DECODE_KERNEL(decode_flash_off_conceal, STATE_FLASH | STATE_CONCEAL)
+
+typedef unsigned (*decode_kernel_t)(const uint8_t *chp,
+	uint32_t entry, cell_t *cells);
+
+// Indexed by [hide concealed][flash on]
+static const decode_kernel_t __render_bank("mode7_tables")
+	decode_kernels[2][2] = {
+	{ decode_flash_off, decode_flash_on },
+	{ decode_flash_off_conceal, decode_flash_on_conceal }
+};
+
+#ifdef CONCEAL_SUPPORT
+static bool hide_concealed = false;
+#else
+#define	hide_concealed	false
+#endif
+
+// Decode one 40-character line into cells[] with the appropriate kernel.
+// Returns LINE_xxx flags.
+static __force_inline unsigned decode_line(const uint8_t *chp,
+	uint32_t entry, bool flash_on, cell_t *cells)
+{
+	return decode_kernels[hide_concealed][flash_on](chp, entry, cells);
+}
+
+// The state after count characters from offset in a window: what the
+// serial attributes are at the left edge of a view.  This follows the
+// decoder above, but just for the state.
+static uint32_t __not_in_flash_func(prescan_line)(const uint8_t *buf,
+	unsigned offset, unsigned wrap_mask, unsigned count)
+{
+	uint32_t state = STATE_RESET;
+
+	while (count-- != 0)
+	{
+		unsigned ch = buf[offset++ & wrap_mask] & 0x7f;
+		const ctrl_action_t *action = &ctrl_actions[(ch < 0x20) ? ch : 0];
+
+		state = (state & ~(uint32_t)action->at_clear) | action->at_set
+			| ((state >> 8) & action->at_copy);
+		if ((state & STATE_GRAPHICS) && (ch & 0x20) && (ch != 0x60))
+		{
+			uint32_t mosaic = MOSAIC_CELL | (ch & 0x1f) | ((ch & 0x40) >> 1)
+				| (state & STATE_SEPARATED);
+
+			state = (state & ~STATE_HELD) | (mosaic << STATE_HELD_SHIFT);
+		}
+		state = (state & ~action->after_clear) | action->after_set;
+	}
+	return state;
+}
+
+
+// The parts of the words that depend on the PIO clock, set by
+// mode7_render_init()
+static uint32_t run_word, run_cell_word, eol_word;
+static unsigned max_run;
+
+// Fill buf[] with the words for one scanline: the pixels of the given row
+// of each decoded cell, followed by the end-of-line marker.  Cells with
+// no pixels set on this row go as runs of the background colour, and
+// cells in the colours the PIO already has go in pairs where they can.
+// Returns the number of words.
+static unsigned __not_in_flash_func(render_scanline)
+	(const cell_t *cells, unsigned row, uint32_t *buf)
+{
+	unsigned ch_pos;
+	uint32_t *out = buf;
+	uint32_t pio_colours = ~0u;	// Colours the PIO will have, if known
+	uint32_t run_bg = 0;
+	unsigned run = 0;			// Cells in the run in out[-1], if any
+	unsigned half = 0;			// Pixels of the cell in out[-1], if it
+								// could be the first of a pair
+
+	// Glyph row to show for each DH_xxx.  The fonts have 19 real rows
+	// (the 20th is a repeat), so the double-height glyph is 38 rows and
+	// the lower half starts halfway through row 9.
+	const unsigned glyph_row[3] = {
+		row, row >> 1, (row + ROWS_PER_LINE - 1) >> 1
+	};
+
+	for (ch_pos = 0; ch_pos < 40; ch_pos++)
+	{
+		const cell_t *cell = &cells[ch_pos];
+		unsigned grow = glyph_row[cell->dh_half];
+		unsigned pixels;
+		uint32_t bg;
+
+		if (cell->mosaic) pixels = mosaic_row(cell->mosaic, grow);
+		else pixels = cell->fontp[grow];
+
+		if (pixels != 0)
+		{
+			run = 0;
+			if (cell->colours != pio_colours)
+			{
+				// Value written has the foreground/background colours
+				// and the pixel data.
+				*out++ = cell->colours | (pixels << 17);
+				pio_colours = cell->colours;
+				half = 0;
+			}
+			else if (half != 0)
+			{
+				// Second of a pair
+				out[-1] = MODE7_PAIR(half | (pixels << 12));
+				half = 0;
+			}
+			else
+			{
+				// Could be the first of a pair, if the next cell
+				// is the same colours too
+				*out++ = cell->colours | (pixels << 17);
+				half = pixels;
+			}
+			continue;
+		}
+
+		// Blank on this row: add it to the run before if that's the
+		// same colour, else start a new one.  This is the PIO's
+		// background colour from now on.
+		half = 0;
+		bg = MODE7_CELL_BG(cell->colours);
+		if ((run != 0) && (bg == run_bg) && (run < max_run))
+		{
+			out[-1] += run_cell_word;
+			run++;
+		}
+		else
+		{
+			*out++ = run_word | (bg << 5);
+			run_bg = bg;
+			run = 1;
+			pio_colours = (pio_colours & ~MODE7_CELL(0x3f, 0, 0))
+				| MODE7_CELL(bg, 0, 0);
+		}
+	}
+
+	// Tell the PIO to wait for HSYNC before the next row, with the
+	// back-porch delay.
+	*out++ = eol_word;
+	return out - buf;
+}
+
+// Cache of the words generated for each character line.  Most pages are
+// static for many seconds, so rather than regenerate every word on every
+// field, each line remembers what it was rendered from and is only
+// re-rendered when that changes.  Otherwise the words are replayed
+// straight from the cache (by DMA if enabled).
+// All 20 rows are kept, as the odd and even fields use alternate rows;
+// rows_valid says which of the two sets has been rendered.
+typedef struct
+{
+	// Key: the 40 characters, the state at the start of the line (which
+	// has the attributes from the left of a view, and the double-height
+	// carry-in from the previous line) and the flash phase (only relevant
+	// if LINE_FLASHING)
+	uint8_t chars[40] __attribute__((aligned(4)));
+	uint32_t entry;
+	bool flash_on;
+
+	uint8_t rows_valid;		// Bit 0 for even rows, bit 1 for odd rows
+	uint8_t line_flags;		// LINE_xxx as returned by decode_line()
+
+	uint8_t word_count[ROWS_PER_LINE];
+	uint32_t words[ROWS_PER_LINE][WORDS_PER_LINE];
+} line_cache_t;
+
+static line_cache_t line_cache[25];
+
+// The state at the start of each line of the page, worked out by
+// mode7_page_snapshot(): STATE_RESET unless the page is a view with
+// attributes to the left of it
+static uint32_t __render_bank("mode7_page") line_entry[25];
+
+// Line cache statistics, written only by the rendering core at the end of
+// each field under a sequence count so they can be read from the other core.
+static mode7_cache_stats_t cache_stats;
+static volatile uint32_t cache_stats_seq;
+
+// Average cycles to render one line, used to estimate the saving on a hit
+static uint64_t total_render_cycles;
+static uint32_t total_renders;
+
+
+#ifdef MODE7_HOST
+
+// On a PC the "cycles" are nanoseconds, truncated to 32 bits like the
+// differences on the Pico.
+static void cycle_count_init(void)
+{
+}
+
+static __force_inline uint32_t cycle_count(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)ts.tv_sec * 1000000000u + (uint32_t)ts.tv_nsec;
+}
+
+// Nanoseconds elapsed since an earlier cycle_count()
+static __force_inline uint32_t cycles_since(uint32_t start)
+{
+	return cycle_count() - start;
+}
+
+#else
+
+// SysTick is used as a free-running 24-bit down-counter of CPU cycles
+// for timing the rendering.  Each core has its own, so this must be
+// called on the core doing the rendering.
+static void cycle_count_init(void)
+{
+	systick_hw->rvr = M0PLUS_SYST_RVR_BITS;
+	systick_hw->cvr = 0;
+	systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS
+		| M0PLUS_SYST_CSR_ENABLE_BITS;
+}
+
+static __force_inline uint32_t cycle_count(void)
+{
+	return systick_hw->cvr;
+}
+
+// Cycles elapsed since an earlier cycle_count() (which counts down)
+static __force_inline uint32_t cycles_since(uint32_t start)
+{
+	return (start - systick_hw->cvr) & M0PLUS_SYST_CVR_BITS;
+}
+
+#endif
+
+
+// Compare and copy the 40 characters of a line's key.  These are done
+// here rather than with memcmp() and memcpy(), as the SDK only keeps its
+// own memcpy() and memset() out of flash, and this is on the render path.
+// Whole words when the line is aligned, as it always is in page_buf.
+static __force_inline bool line_key_same(const uint8_t *key,
+	const uint8_t *chp)
+{
+	if (((uintptr_t)chp & 3) == 0)
+	{
+		const uint32_t *a = (const uint32_t *)key;
+		const uint32_t *b = (const uint32_t *)chp;
+
+		for (unsigned u = 0; u < 40 / 4; u++)
+			if (a[u] != b[u]) return false;
+		return true;
+	}
+	for (unsigned u = 0; u < 40; u++)
+		if (key[u] != chp[u]) return false;
+	return true;
+}
+
+static __force_inline void line_key_copy(uint8_t *key, const uint8_t *chp)
+{
+	if (((uintptr_t)chp & 3) == 0)
+	{
+		uint32_t *a = (uint32_t *)key;
+		const uint32_t *b = (const uint32_t *)chp;
+
+		for (unsigned u = 0; u < 40 / 4; u++) a[u] = b[u];
+		return;
+	}
+	for (unsigned u = 0; u < 40; u++) key[u] = chp[u];
+}
+
+// Check whether the cached words for a line can be used for this field.
+// If not, resets the entry ready to be re-rendered from the given key.
+static __force_inline bool line_cache_lookup(line_cache_t *lc,
+	const uint8_t *chp, uint32_t entry, bool flash_on, unsigned parity)
+{
+	bool same;
+
+	// The flash phase only matters if there's something flashing
+	same = (lc->entry == entry)
+		&& (!(lc->line_flags & LINE_FLASHING) || (lc->flash_on == flash_on))
+		&& line_key_same(lc->chars, chp);
+
+	if (!same)
+	{
+		// Rows rendered for the other field are no good either
+		lc->rows_valid = 0;
+		line_key_copy(lc->chars, chp);
+		lc->entry = entry;
+		lc->flash_on = flash_on;
+	}
+	return (lc->rows_valid & (1 << parity)) != 0;
+}
+
+
+
+// Per-field working counts, published as mode7_cache_stats_t at the end
+// of each field by whichever core is doing the rendering.
+typedef struct
+{
+	unsigned hits, misses, rows_rendered;
+	uint32_t decode_cycles, row_cycles, lookup_cycles, hit_lookup_cycles;
+} field_counts_t;
+
+// Look up one line in the cache for this field and, if it needs
+// re-rendering, decode it into cells[] ready for render_line_row().
+// Returns true if the cached rows can be used as they are.
+static bool __not_in_flash_func(prepare_line)(line_cache_t *lc,
+	const uint8_t *chp, uint32_t entry, bool flash_on, unsigned first_row,
+	cell_t *cells, field_counts_t *counts)
+{
+	uint32_t start, cycles;
+	bool hit;
+
+	start = cycle_count();
+	hit = line_cache_lookup(lc, chp, entry, flash_on, first_row);
+	cycles = cycles_since(start);
+	counts->lookup_cycles += cycles;
+	if (hit)
+	{
+		counts->hits++;
+		counts->hit_lookup_cycles += cycles;
+	}
+	else
+	{
+		// Decode the serial attributes just once for the whole line.
+		counts->misses++;
+		start = cycle_count();
+		lc->line_flags = decode_line(chp, entry, flash_on, cells);
+		counts->decode_cycles += cycles_since(start);
+	}
+	return hit;
+}
+
+// Render one row of a line that missed in the cache
+static __force_inline void render_line_row(line_cache_t *lc,
+	const cell_t *cells, unsigned row, field_counts_t *counts)
+{
+	uint32_t start = cycle_count();
+
+	lc->word_count[row] = render_scanline(cells, row, lc->words[row]);
+	counts->row_cycles += cycles_since(start);
+	counts->rows_rendered++;
+}
+
+// Fix up for double height at the end of each line.  If we were doing a
+// proper display, we'd repeat the previous line; however, this is
+// emulating a BBC micro that requires the user to fill in the 2nd line
+// so we just set the flags that will cause us to select the
+// lower-half font next time round.
+static __force_inline bool next_second_row_dh(bool second_row_dh,
+	const line_cache_t *lc)
+{
+	if (second_row_dh) return false;
+	return (lc->line_flags & LINE_DBL_HEIGHT) != 0;
+}
+
+// Update the statistics at the end of a field.  The saving is estimated
+// from the average cost of rendering a line, less what the cache lookups
+// cost.
+static void publish_stats(const field_counts_t *counts)
+{
+	uint32_t render_cycles = counts->decode_cycles + counts->row_cycles;
+
+	total_render_cycles += render_cycles;
+	total_renders += counts->misses;
+	cache_stats_seq++;
+	__dmb();
+	cache_stats.fields++;
+	cache_stats.hits = counts->hits;
+	cache_stats.misses = counts->misses;
+	cache_stats.total_hits += counts->hits;
+	cache_stats.total_misses += counts->misses;
+	cache_stats.render_cycles = render_cycles;
+	cache_stats.decode_cycles = counts->decode_cycles;
+	cache_stats.row_cycles = counts->row_cycles;
+	cache_stats.rows_rendered = counts->rows_rendered;
+	cache_stats.lookup_cycles = counts->lookup_cycles;
+	if (total_renders != 0)
+	{
+		uint32_t saved = counts->hits * (total_render_cycles / total_renders);
+		cache_stats.cycles_saved = (saved > counts->hit_lookup_cycles)
+			? saved - counts->hit_lookup_cycles : 0;
+	}
+	__dmb();
+	cache_stats_seq++;
+}
+
+
+// The 40 characters of a line of the page.  A line that runs off the end
+// of its window is put together in line_buf.
+static __force_inline const uint8_t *line_chars(const mode7_page_t *page,
+	unsigned line, uint8_t *line_buf)
+{
+	unsigned offset;
+
+	if (page->lines != NULL) return page->lines[line];
+	offset = (page->start + line * page->stride) & page->wrap_mask;
+	if (offset + 39 <= page->wrap_mask) return page->buf + offset;
+	for (unsigned u = 0; u < 40; u++)
+		line_buf[u] = page->buf[(offset + u) & page->wrap_mask];
+	return line_buf;
+}
+
+// Get the page ready to render this field.  The state at the left edge
+// of each line of a view is worked out here, and with RENDER_DATA_IN_SRAM
+// a page in flash is copied into SRAM, as reading it from flash during
+// active video could glitch the output.  The lines are copied in order
+// wherever they come from, so the copy is an ordinary page.  From a table
+// of lines only those in flash are copied.  A page anywhere else is
+// rendered from where it is, with nothing copied.
+// Returns the page to pass to mode7_render_field(), which must be given
+// the result of this, not the page itself.
+const mode7_page_t *__not_in_flash_func(mode7_page_snapshot)
+	(const mode7_page_t *page)
+{
+	for (unsigned line = 0; line < 25; line++)
+	{
+		line_entry[line] = ((page->lines == NULL) && (page->left != 0))
+			? prescan_line(page->buf, page->start + line * page->stride
+				- page->left, page->wrap_mask, page->left)
+			: STATE_RESET;
+	}
+
+#if RENDER_DATA_IN_SRAM
+	if (page->lines != NULL)
+	{
+		bool copied = false;
+
+		for (unsigned line = 0; line < 25; line++)
+		{
+			const uint8_t *chars = page->lines[line];
+
+			if (in_xip_flash(chars))
+			{
+				memcpy(page_buf + line * 40, chars, 40);
+				chars = page_buf + line * 40;
+				copied = true;
+			}
+			lines_snapshot[line] = chars;
+		}
+		return copied ? &lines_page : page;
+	}
+	if (!in_xip_flash(page->buf)) return page;
+	if ((page->stride == 40)
+		&& ((page->start & page->wrap_mask) + PAGE_BYTES - 1
+			<= page->wrap_mask))
+	{
+		// All in one piece
+		memcpy(page_buf, page->buf + (page->start & page->wrap_mask),
+			PAGE_BYTES);
+	}
+	else
+	{
+		for (unsigned line = 0; line < 25; line++)
+		{
+			uint8_t *copy = page_buf + line * 40;
+			const uint8_t *chars = line_chars(page, line, copy);
+
+			if (chars != copy) memcpy(copy, chars, 40);
+		}
+	}
+	return &page_snapshot;
+#else
+	return page;
+#endif
+}
+
+
+// Render one field of the page, from row first_row (0 or 1) of each line
+// stepping by two for the interlace.  Lines that are unchanged since they
+// were last rendered for this parity are replayed from the line cache.
+// Each scanline is passed to output (if not NULL) as soon as it is ready,
+// so whatever feeds the PIO is never more than one scanline behind; each
+// row is rendered just before it is queued.  line_done (if not NULL) is
+// told as each line is finished.
+void __not_in_flash_func(mode7_render_field)(const mode7_page_t *page,
+	bool flash_on, unsigned first_row, mode7_output_fn output,
+	mode7_line_fn line_done)
+{
+	unsigned line;			// Which line out of the 25? (0..24)
+	unsigned row;			// Which pixel row within a line (0..19)
+	unsigned scanline;		// Scanline within this field's output
+	bool second_row_dh;
+	field_counts_t counts = { 0 };
+
+	// The current line, decoded into font cells and colours
+	cell_t cells[40];
+	// ... and its characters, if they wrap around the window
+	uint8_t line_buf[40];
+
+	second_row_dh = false;
+	scanline = 0;
+	for (line = 0; line < 25; line++)
+	{
+		line_cache_t *lc = &line_cache[line];
+		bool hit = prepare_line(lc, line_chars(page, line, line_buf),
+			line_entry[line] | (second_row_dh ? STATE_2ND_ROW_DH : 0),
+			flash_on, first_row, cells, &counts);
+
+		// Interlaced display, so step on by two rows
+		for (row = first_row; row < ROWS_PER_LINE; row += 2)
+		{
+			if (!hit) render_line_row(lc, cells, row, &counts);
+			if (output)
+			{
+				output(scanline, lc->words[row], lc->word_count[row],
+					(line == 24) && (row + 2 >= ROWS_PER_LINE));
+			}
+			scanline++;
+		}
+		lc->rows_valid |= 1 << first_row;
+		second_row_dh = next_second_row_dh(second_row_dh, lc);
+
+		if (line_done)
+		{
+			// Make sure the words are all written before anyone
+			// else can see them
+			__dmb();
+			line_done(line);
+		}
+	}
+	publish_stats(&counts);
+}
+
+// The words for one row of a line, as last rendered, and how many
+const uint32_t *__not_in_flash_func(mode7_line_words)(unsigned line,
+	unsigned row, unsigned *count)
+{
+	*count = line_cache[line].word_count[row];
+	return line_cache[line].words[row];
+}
+
+
+// Times the output caught up with the rendering and had to wait for a line
+static volatile unsigned render_stalls;
+
+void __not_in_flash_func(mode7_count_render_stall)(void)
+{
+	render_stalls++;
+}
+
+// Take a consistent copy of the line cache statistics.
+// Can be called from either core.
+void mode7_get_cache_stats(mode7_cache_stats_t *stats)
+{
+	uint32_t seq;
+
+	do
+	{
+		// Odd sequence number means an update is in progress
+		while ((seq = cache_stats_seq) & 1)
+			tight_loop_contents();
+		__dmb();
+		*stats = cache_stats;
+		__dmb();
+	} while (seq != cache_stats_seq);
+	stats->render_stalls = render_stalls;
+}
+
+
+// Where the renderer's data ended up, for checking the placement
+static const mode7_placement_t placement[] = {
+	{ "font", render_font, sizeof(font_std) },
+#if RENDER_DATA_IN_SRAM
+	{ "page buffer", page_buf, sizeof(page_buf) },
+	{ "line table", lines_snapshot, sizeof(lines_snapshot) },
+#endif
+	{ "DH table", dh_half_list, sizeof(dh_half_list) },
+	{ "control codes", ctrl_actions, sizeof(ctrl_actions) },
+	{ "decode kernels", decode_kernels, sizeof(decode_kernels) },
+	{ "mosaic shifts", mosaic_shift, sizeof(mosaic_shift) },
+	{ "mosaic pairs", mosaic_pair, sizeof(mosaic_pair) },
+	{ "mosaic masks", mosaic_mask, sizeof(mosaic_mask) },
+	{ "line cache", line_cache, sizeof(line_cache) }
+};
+
+// Returns the number of entries in the list.
+unsigned mode7_get_placement(const mode7_placement_t **list)
+{
+	*list = placement;
+	return count_of(placement);
+}
+
+
+// Set up the renderer's data for the given PIO clock (see mode7_render.h).
+// Must be called before anything else here.
+void mode7_render_init(unsigned pio_mhz)
+{
+	run_word = MODE7_RUN(0, 1, pio_mhz);
+	run_cell_word = MODE7_RUN_CELL(pio_mhz);
+	max_run = MODE7_MAX_RUN(pio_mhz);
+	eol_word = MODE7_EOL(pio_mhz);
+
+#if RENDER_DATA_IN_SRAM
+	memcpy(render_font, font_std, sizeof(render_font));
+#endif
+	mode7_flush_line_cache();
+}
+
+// Forget all the cached lines, so the next field is rendered from scratch
+void mode7_flush_line_cache(void)
+{
+	for (unsigned line = 0; line < 25; line++)
+		line_cache[line].rows_valid = 0;
+}
+
+// Set up the calling core to do the rendering: its cycle counter is
+// used for the statistics.
+void mode7_render_core_init(void)
+{
+	cycle_count_init();
+}
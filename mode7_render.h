@@ -0,0 +1,227 @@
+// The teletext decoder and scanline renderer.  This has no dependency on
+// the PIO or the sync input: mode7.c waits for the field and feeds the
+// words to the PIO, and the host build (see host/) feeds them to a mock
+// FIFO instead, so the same code can be tested and timed on a PC.
+
+#ifndef MODE7_RENDER_H
+#define MODE7_RENDER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef MODE7_HOST
+
+// Building on a PC: stand-ins for the bits of the Pico SDK used here.
+// SYSCLK_MHZ comes from the build, which reads it out of mode7.pio, and
+// is the clock the host programs give mode7_render_init() unless told
+// otherwise.
+#include <stddef.h>
+#define	__not_in_flash_func(func)	func
+#define	__force_inline				inline __attribute__((always_inline))
+#define	__scratch_x(group)
+#define	__scratch_y(group)
+#define	__dmb()						__atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define	tight_loop_contents()		do {} while (0)
+#define	count_of(a)					(sizeof(a) / sizeof((a)[0]))
+
+#else
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "mode7.pio.h"
+
+#endif
+
+
+// Compile option to have the SIO interpolator generate the glyph address
+// for each character, rather than doing the arithmetic on the CPU.
+#define	DECODE_USE_INTERP	0
+
+// Compile option to do all the decoding and rendering on core0 (from an
+// interrupt set up by mode7_render_start()), leaving core1 just feeding
+// the PIO.
+#define	RENDER_ON_CORE0	0
+
+// Compile option to keep everything the renderer reads during active video
+// out of XIP flash, where a cache miss (eg. from the other core) could
+// delay it enough to glitch the output.  The font is copied to SRAM at
+// initialisation, and a page in flash is copied each field to a buffer in
+// the rendering core's scratch bank along with the small lookup tables.
+// That bank otherwise only has the same core's stack in it, so nothing
+// else - including the DMA, which reads the striped line cache - ever
+// contends with the renderer for it.  A page already in SRAM is rendered
+// from where it is.
+#define	RENDER_DATA_IN_SRAM	1
+
+#ifdef MODE7_HOST_INTERP
+// On a PC the interpolator is modelled (see host/mock_interp.h), and the
+// host build checks the decoder with it as well as with whatever is set
+// above
+#undef	DECODE_USE_INTERP
+#define	DECODE_USE_INTERP	1
+#endif
+
+// Adjust BACK_PORCH and VERTICAL_POS to position the display on screen.
+
+// The timings in the PIO words are in cycles of the PIO clock, which is
+// a multiple of 12MHz chosen by mode7_init() to suit the system clock
+// (see mode7.c).  pio_mhz below is that clock in MHz, so also the cycles
+// per character cell.
+
+// Back porch delay from falling edge of HSYNC to first pixel, in units
+// of the PIO clock.  Can tweak this to get the horizontal position right.
+// Official back-porch (rising HSYNC to video) is 5.7us, plus 4.7us for
+// HSYNC itself leaves 53.6us for active video, of which we actually use 40
+// so 13.6 spare, put 6.8 either side to centre it.
+// = 5.7+4.7+6.8 = 17.2us
+#define BACK_PORCH(pio_mhz)	((pio_mhz) * 172 / 10)
+
+// Words for the mode7_output PIO program (see mode7.pio), each starting
+// with the address of the code that handles it.
+// A cell of 12 pixels, with its colours:
+#define	MODE7_CELL(bg, fg, pixels)	(MODE7_WORD_CELL | ((bg) << 5)	\
+	| ((fg) << 11) | ((uint32_t)(pixels) << 17))
+#define	MODE7_CELL_BG(word)		(((word) >> 5) & 0x3f)
+
+// Two cells of pixels in the colours the PIO already has
+#define	MODE7_PAIR(pixels)		(MODE7_WORD_PAIR | ((uint32_t)(pixels) << 5))
+
+// A run of cells all in colour bg, and what to add to it for each extra
+// cell.  A run can be up to MODE7_MAX_RUN cells, as the count of cycles
+// is only 12 bits.
+#define	MODE7_RUN(bg, cells, pio_mhz)	(MODE7_WORD_RUN | ((bg) << 5)	\
+	| ((uint32_t)((cells) * (pio_mhz) - MODE7_RUN_OVERHEAD) << 11))
+#define	MODE7_RUN_CELL(pio_mhz)	((uint32_t)(pio_mhz) << 11)
+#define	MODE7_MAX_RUN(pio_mhz)	((0xfff + MODE7_RUN_OVERHEAD) / (pio_mhz))
+
+// End of line marker, with the back porch delay less the cycles the PIO
+// program spends getting to the first pixel.  The delay is 12 bits too,
+// which limits the PIO clock to MODE7_MAX_PIO_MHZ.
+#define	MODE7_EOL(pio_mhz)	(MODE7_WORD_EOL	\
+	| ((uint32_t)(BACK_PORCH(pio_mhz) - MODE7_EOL_OVERHEAD) << 5))
+#define	MODE7_MAX_PIO_MHZ	((0xfff + MODE7_EOL_OVERHEAD) * 10 / 172)
+
+#define	MODE7_WORD_TYPE(word)	((word) & 0x1f)
+
+// There are 320 video lines after the VSYNC, of which we output on 250.
+// So there's 70 blank lines to distribute in top/bottom border.
+// Even split would be 35, but I believe the gap at the top is normally
+// a bit smaller.  This is also not going to be 100% right between
+// Electron-style syncs (normal HSYNCs start right after VSYNC)
+// and proper PAL where there are equalising pulses.
+// This constant defines the number of skipped lines after the first
+// HSYNC detected after VSYNC.
+#define	VERTICAL_POS	30
+
+// Note that the current font was optimised to fit in a 640x480 VGA screen,
+// so had only 19 rows per character line.  It has now been stretched by
+// duplicating the last row (which is always zero on alpha characters anyhow),
+// but may not be right in the case of graphics.
+#define	ROWS_PER_LINE	20
+#define	FONT_ROWS		20
+
+// Most words sent to the PIO for each scanline: one per character cell,
+// plus the end-of-line marker.  Runs of blank cells go as one word, and
+// cells in the same colours as the one before go in pairs, so there are
+// usually fewer.
+#define	WORDS_PER_LINE	41
+
+// Size of the teletext page
+#define	PAGE_BYTES		(25 * 40)
+
+// The page starts at an offset into a window of memory, and wraps around
+// to the start of it, as the BBC Micro's 6845 does in the 1K at &7C00 when
+// software scrolls by moving the screen start address.  The renderer is
+// given the offset and a wrap mask of one less than the size of the
+// window, which must be a power of two.  A page that is just PAGE_BYTES
+// in a buffer of its own is at offset 0 with a mask of PAGE_WINDOW - 1.
+// Scrolling this way moves none of the text: the window is rendered from
+// where it is, with only a line that wraps around it put together as it
+// is decoded.  (It's copied each field only if it's in flash.)
+#define	PAGE_WINDOW		1024
+
+// Where the page to display is.  If lines is set, each of the 25 lines is
+// wherever it points, so parts of the screen can come from different
+// buffers with nothing copied (except, with RENDER_DATA_IN_SRAM, any
+// lines in flash); otherwise the page is in the window at buf.
+// The page can also be a view of a surface of text wider than 40
+// characters: the lines are stride apart, and left is how far the view
+// is from the start of each line.  The characters to the left are
+// scanned every field for the serial attributes in effect at the left
+// edge, so changes to them show at once.
+// The table and the buffers must stay put until the field is displayed.
+typedef struct
+{
+	const uint8_t *buf;
+	unsigned start, wrap_mask;
+	unsigned stride, left;
+	const uint8_t *const *lines;
+} mode7_page_t;
+
+// A page of PAGE_BYTES at buf
+#define	MODE7_PAGE(buf)		\
+	((mode7_page_t){ (buf), 0, PAGE_WINDOW - 1, 40, 0, NULL })
+
+// The 40x25 view at column x and line y of a surface at buf, with lines
+// of stride characters.  It can be panned by just changing x and y.
+#define	MODE7_VIEW(buf, stride, x, y)	\
+	((mode7_page_t){ (buf), (y) * (stride) + (x), ~0u, (stride), (x), NULL })
+
+
+// test_pages.c
+#define NOOF_TEST_PAGES 4
+extern const uint8_t * const test_pages[NOOF_TEST_PAGES];
+
+// fonts.c
+extern const uint16_t font_std[96*20];
+
+// mode7_render.c
+// Line cache statistics.  The per-field values are for the last field.
+typedef struct
+{
+	unsigned fields;			// Fields displayed so far
+	unsigned hits;				// Lines replayed from the cache
+	unsigned misses;			// Lines that had to be re-rendered
+	unsigned total_hits;		// Running totals of the above
+	unsigned total_misses;
+	unsigned render_cycles;		// CPU cycles spent rendering missed lines
+	unsigned decode_cycles;		// ... of which decoding the attributes
+	unsigned row_cycles;		// ... and generating the scanlines
+	unsigned rows_rendered;		// Scanlines generated
+	unsigned lookup_cycles;		// CPU cycles spent checking the cache
+	unsigned cycles_saved;		// Estimate of CPU cycles saved by the hits
+	unsigned render_stalls;		// Lines not rendered in time (RENDER_ON_CORE0)
+} mode7_cache_stats_t;
+
+// Location of one of the renderer's data objects
+typedef struct
+{
+	const char *name;
+	const void *addr;
+	unsigned size;
+} mode7_placement_t;
+
+// Called by mode7_render_field() with the words for each scanline as soon
+// as they are ready, in order.  count is the number of words, the last of
+// which is the end-of-line marker.  last is set for the final scanline of
+// the field.
+typedef void (*mode7_output_fn)(unsigned scanline, const uint32_t *words,
+	unsigned count, bool last);
+
+// Called by mode7_render_field() once all of a line's rows for the field
+// are ready, ie. can be read with mode7_line_words().
+typedef void (*mode7_line_fn)(unsigned line);
+
+extern void mode7_render_init(unsigned pio_mhz);
+extern void mode7_render_core_init(void);
+extern void mode7_flush_line_cache(void);
+extern const mode7_page_t *mode7_page_snapshot(const mode7_page_t *page);
+extern void mode7_render_field(const mode7_page_t *page, bool flash_on,
+	unsigned first_row, mode7_output_fn output, mode7_line_fn line_done);
+extern const uint32_t *mode7_line_words(unsigned line, unsigned row,
+	unsigned *count);
+extern void mode7_count_render_stall(void);
+extern void mode7_get_cache_stats(mode7_cache_stats_t *stats);
+extern unsigned mode7_get_placement(const mode7_placement_t **list);
+
+#endif
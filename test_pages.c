@@ -2,7 +2,7 @@
 // Generated with:
 //  hexdump -v -e '1/1 "0x%02x,"'  file.bin >file.hex
 
-#include "mode7_demo.h"
+#include "mode7_render.h"
 
 static const uint8_t page100[1000] =
 {